@@ -1,12 +1,25 @@
 #pragma once
 
+#include "src/vec.h"
 #include "src/tuple2.h"
 #include "src/tuple3.h"
 #include "src/tuple4.h"
 #include "src/vector.h"
 #include "src/matrix.h"
+#include "src/matrix_expr.h"
+#include "src/lu.h"
+#include "src/dynamic_matrix.h"
+#include "src/view.h"
+#include "src/cached_matrix.h"
 #include "src/transform.h"
+#include "src/affine.h"
+#include "src/structured_matrix.h"
 #include "src/trig.h"
 #include "src/point.h"
+#include "src/point3.h"
+#include "src/vector3.h"
+#include "src/point_array.h"
+#include "src/packet.h"
 #include "src/quaternion.h"
 #include "src/comparison.h"
+#include "src/simd.h"
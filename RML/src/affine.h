@@ -0,0 +1,503 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <iostream>
+#include <type_traits>
+#include "matrix.h"
+#include "tuple3.h"
+#include "tuple4.h"
+#include "point.h"
+#include "vector.h"
+#include "point3.h"
+#include "vector3.h"
+#include "quaternion.h"
+#include "transform.h"
+#include "view.h"
+#include "parallel.h"
+#include "simd.h"
+
+namespace RML
+{
+	/// <summary>
+	/// An affine transform stored as the top three rows of a 4x4 Matrix, i.e. a 3x4 Matrix whose bottom row is taken to be 0, 0, 0, 1.
+	/// Uses 12 numbers instead of 16, and composes with 36 multiply-adds instead of 64.
+	/// The numbers are row-major, so data() matches the first 12 numbers of the equivalent Matrix&lt;T, 4, 4&gt;.
+	/// </summary>
+	/// <typeparam name="T">The type of number to store, e.g. float, double...</typeparam>
+	template<class T>
+	class Affine3
+	{
+	public:
+		/// <summary>
+		/// Creates the identity transform
+		/// </summary>
+		constexpr Affine3() : m_data({
+			1, 0, 0, 0,
+			0, 1, 0, 0,
+			0, 0, 1, 0
+			}) {}
+
+		/// <summary>
+		/// Creates an Affine3 from the top three rows of an affine Matrix, given row by row
+		/// </summary>
+		/// <param name="data">The 12 numbers of the top three rows</param>
+		constexpr Affine3(const std::array<T, 12> data) : m_data(data) {}
+
+		/// <summary>
+		/// Creates an Affine3 from a 3x3 linear part and a translation
+		/// </summary>
+		/// <param name="linear">The rotation, scale and shear</param>
+		/// <param name="translation">The translation</param>
+		constexpr Affine3(const Matrix<T, 3, 3>& linear, const Tuple3<T>& translation) : m_data({
+			linear(0, 0), linear(0, 1), linear(0, 2), translation.x(),
+			linear(1, 0), linear(1, 1), linear(1, 2), translation.y(),
+			linear(2, 0), linear(2, 1), linear(2, 2), translation.z()
+			}) {}
+
+		/// <summary>
+		/// Creates an Affine3 from an affine 4x4 Matrix, i.e. one whose bottom row is 0, 0, 0, 1.
+		/// The bottom row is dropped without being checked.
+		/// </summary>
+		/// <param name="matrix">The Matrix to convert</param>
+		template<Layout LAYOUT>
+		explicit constexpr Affine3(const Matrix<T, 4, 4, LAYOUT>& matrix) : m_data()
+		{
+			for (int row = 0; row < 3; ++row)
+			{
+				for (int col = 0; col < 4; ++col)
+				{
+					m_data[row * 4 + col] = matrix(row, col);
+				}
+			}
+		}
+
+		/// <summary>
+		/// Creates an Affine3 that rotates by a Quaternion
+		/// </summary>
+		/// <param name="rotation">The rotation</param>
+		explicit Affine3(const Quaternion& rotation) : Affine3(Matrix<T, 4, 4>(rotation.matrix())) {}
+
+		/// <summary>
+		/// Creates an Affine3 from the matrix of a Transform
+		/// </summary>
+		/// <param name="transform">The Transform to convert</param>
+		explicit Affine3(const Transform& transform) : Affine3(Matrix<T, 4, 4>(transform.matrix())) {}
+
+		/// <summary>
+		/// Creates the identity transform
+		/// </summary>
+		static constexpr Affine3 identity()
+		{
+			return Affine3();
+		}
+
+		/// <summary>
+		/// Subscript operator, accesses the value at row, column of the top three rows
+		/// </summary>
+		/// <param name="row">The row to access, from 0 to 2</param>
+		/// <param name="column">The column to access, from 0 to 3</param>
+		constexpr T& operator() (const int row, const int column)
+		{
+			return m_data[row * 4 + column];
+		}
+
+		/// <summary>
+		/// Subscript operator, accesses the value at row, column as readonly.
+		/// Row 3 returns the implied bottom row, 0, 0, 0, 1.
+		/// </summary>
+		/// <param name="row">The row to access, from 0 to 3</param>
+		/// <param name="column">The column to access, from 0 to 3</param>
+		constexpr T operator() (const int row, const int column) const
+		{
+			if (row == 3)
+			{
+				return column == 3 ? T(1) : T(0);
+			}
+
+			return m_data[row * 4 + column];
+		}
+
+		/// <summary>
+		/// Returns the 3x3 rotation, scale and shear part
+		/// </summary>
+		constexpr Matrix<T, 3, 3> linear() const
+		{
+			const auto& m = m_data;
+
+			return Matrix<T, 3, 3>({
+				m[0], m[1], m[2],
+				m[4], m[5], m[6],
+				m[8], m[9], m[10]
+			});
+		}
+
+		/// <summary>
+		/// Returns the translation
+		/// </summary>
+		constexpr Tuple3<T> translation() const
+		{
+			return Tuple3<T>(m_data[3], m_data[7], m_data[11]);
+		}
+
+		/// <summary>
+		/// Returns the transform as a full 4x4 Matrix
+		/// </summary>
+		/// <typeparam name="LAYOUT">The layout of the Matrix, e.g. ColumnMajor to upload it to a graphics API</typeparam>
+		template<Layout LAYOUT = Layout::RowMajor>
+		constexpr Matrix<T, 4, 4, LAYOUT> matrix() const
+		{
+			const auto& m = m_data;
+
+			return Matrix<T, 4, 4, LAYOUT>({
+				m[0], m[1], m[2],  m[3],
+				m[4], m[5], m[6],  m[7],
+				m[8], m[9], m[10], m[11],
+				0,    0,    0,     1
+			});
+		}
+
+		/// <summary>
+		/// Returns a Transform with the position, rotation and scale of the Affine3.
+		/// Shear cannot be represented by a Transform, and is lost.
+		/// </summary>
+		Transform transform() const
+		{
+			return Transform(Matrix<double, 4, 4>(matrix()));
+		}
+
+		/// <summary>
+		/// Returns the rotation of the Affine3, with its scale removed
+		/// </summary>
+		Quaternion rotation() const
+		{
+			return transform().rotation();
+		}
+
+		/// <summary>
+		/// Calculates the determinant of the 3x3 linear part, which is also the determinant of the whole 4x4 transform
+		/// </summary>
+		/// <returns>The determinant</returns>
+		constexpr T determinant() const
+		{
+			const auto& m = m_data;
+
+			return m[0] * (m[5] * m[10] - m[6] * m[9])
+				+ m[1] * (m[6] * m[8] - m[4] * m[10])
+				+ m[2] * (m[4] * m[9] - m[5] * m[8]);
+		}
+
+		/// <summary>
+		/// Checks if the Affine3 can be inverted
+		/// </summary>
+		/// <returns>True if it can be inverted, else false</returns>
+		constexpr bool invertible() const
+		{
+			return determinant() != 0;
+		}
+
+		/// <summary>
+		/// Creates a copy of the Affine3 that is inverted.
+		/// The 3x3 linear part is inverted, and the translation is transformed back by it.
+		/// </summary>
+		/// <returns>The inverted Affine3, or a copy of the Affine3 if it is not invertible</returns>
+		constexpr Affine3 inverse() const
+		{
+			return Affine3(matrix().affine_inverse());
+		}
+
+		/// <summary>
+		/// Creates a copy of a rigid Affine3 that is inverted, i.e. one that only rotates and translates.
+		/// The rotation is inverted by transposing it, so the result is wrong for any other Affine3.
+		/// </summary>
+		/// <returns>The inverted Affine3</returns>
+		constexpr Affine3 rigid_inverse() const
+		{
+			const auto& m = m_data;
+			const T x = m[3], y = m[7], z = m[11];
+
+			return Affine3({
+				m[0], m[4], m[8],  -(m[0] * x + m[4] * y + m[8] * z),
+				m[1], m[5], m[9],  -(m[1] * x + m[5] * y + m[9] * z),
+				m[2], m[6], m[10], -(m[2] * x + m[6] * y + m[10] * z)
+			});
+		}
+
+		/// <summary>
+		/// Composes two transforms. The right hand side is applied first.
+		/// </summary>
+		/// <param name="other">The transform to apply before this one</param>
+		/// <returns>The composed transform</returns>
+		constexpr Affine3 operator*(const Affine3& other) const
+		{
+			Affine3 result;
+
+			if (detail::is_constant_evaluated())
+			{
+				detail::multiply3x4_scalar(m_data.data(), other.m_data.data(), result.m_data.data());
+			}
+			else
+			{
+				detail::multiply3x4(m_data.data(), other.m_data.data(), result.m_data.data());
+			}
+
+			return result;
+		}
+
+		/// <summary>
+		/// Composes the transforms, so that other is applied before this one
+		/// </summary>
+		/// <param name="other">The transform to apply before this one</param>
+		/// <returns>The Affine3 after being composed</returns>
+		constexpr Affine3& operator*=(const Affine3& other)
+		{
+			*this = *this * other;
+			return *this;
+		}
+
+		/// <summary>
+		/// Multiplies the Affine3 with a Tuple, treating the Tuple as a column.
+		/// The w component is passed through unchanged.
+		/// </summary>
+		/// <param name="tuple">The Tuple to multiply</param>
+		/// <returns>The product as a Tuple</returns>
+		constexpr Tuple4<T> operator*(const Tuple4<T>& tuple) const
+		{
+			const auto& m = m_data;
+			const T x = tuple.x(), y = tuple.y(), z = tuple.z(), w = tuple.w();
+
+			return Tuple4<T>(
+				m[0] * x + m[1] * y + m[2] * z + m[3] * w,
+				m[4] * x + m[5] * y + m[6] * z + m[7] * w,
+				m[8] * x + m[9] * y + m[10] * z + m[11] * w,
+				w
+			);
+		}
+
+		/// <summary>
+		/// Transforms a point. The w component is taken to be 1.
+		/// </summary>
+		/// <param name="point">The point to transform</param>
+		/// <returns>The transformed point, with w set to 1</returns>
+		constexpr Tuple4<T> transform_point(const Tuple4<T>& point) const
+		{
+			const auto& m = m_data;
+			const T x = point.x(), y = point.y(), z = point.z();
+
+			return Tuple4<T>(
+				m[0] * x + m[1] * y + m[2] * z + m[3],
+				m[4] * x + m[5] * y + m[6] * z + m[7],
+				m[8] * x + m[9] * y + m[10] * z + m[11],
+				1
+			);
+		}
+
+		/// <summary>
+		/// Transforms a vector. The w component is taken to be 0, so the translation is skipped.
+		/// </summary>
+		/// <param name="vector">The vector to transform</param>
+		/// <returns>The transformed vector, with w set to 0</returns>
+		constexpr Tuple4<T> transform_vector(const Tuple4<T>& vector) const
+		{
+			const auto& m = m_data;
+			const T x = vector.x(), y = vector.y(), z = vector.z();
+
+			return Tuple4<T>(
+				m[0] * x + m[1] * y + m[2] * z,
+				m[4] * x + m[5] * y + m[6] * z,
+				m[8] * x + m[9] * y + m[10] * z,
+				0
+			);
+		}
+
+		/// <summary>
+		/// Transforms a Point3, translation included
+		/// </summary>
+		/// <param name="point">The point to transform</param>
+		/// <returns>The transformed point</returns>
+		constexpr Point3<T> operator*(const Point3<T>& point) const
+		{
+			const auto& m = m_data;
+			const T x = point.x(), y = point.y(), z = point.z();
+
+			return Point3<T>(
+				m[0] * x + m[1] * y + m[2] * z + m[3],
+				m[4] * x + m[5] * y + m[6] * z + m[7],
+				m[8] * x + m[9] * y + m[10] * z + m[11]
+			);
+		}
+
+		/// <summary>
+		/// Transforms a Vector3. Vectors are not translated.
+		/// </summary>
+		/// <param name="vector">The vector to transform</param>
+		/// <returns>The transformed vector</returns>
+		constexpr Vector3<T> operator*(const Vector3<T>& vector) const
+		{
+			const auto& m = m_data;
+			const T x = vector.x(), y = vector.y(), z = vector.z();
+
+			return Vector3<T>(
+				m[0] * x + m[1] * y + m[2] * z,
+				m[4] * x + m[5] * y + m[6] * z,
+				m[8] * x + m[9] * y + m[10] * z
+			);
+		}
+
+		/// <summary>
+		/// Transforms an array of Points
+		/// </summary>
+		/// <param name="in">The Points to transform</param>
+		/// <param name="out">Receives the transformed Points. May be the same array as in.</param>
+		/// <param name="count">The amount of Points</param>
+		/// <param name="threads">The most threads to split large arrays across. 0 uses every hardware thread.</param>
+		void apply(const Point* in, Point* out, const std::size_t count, const unsigned int threads = 1) const
+		{
+			detail::parallel_for(count, threads, [&](std::size_t begin, std::size_t end) {
+				detail::transform_aos<true>(m_data.data(), in + begin, out + begin, end - begin);
+			});
+		}
+
+		/// <summary>
+		/// Transforms an array of Vectors. Vectors are not translated.
+		/// </summary>
+		/// <param name="in">The Vectors to transform</param>
+		/// <param name="out">Receives the transformed Vectors. May be the same array as in.</param>
+		/// <param name="count">The amount of Vectors</param>
+		/// <param name="threads">The most threads to split large arrays across. 0 uses every hardware thread.</param>
+		void apply(const Vector* in, Vector* out, const std::size_t count, const unsigned int threads = 1) const
+		{
+			detail::parallel_for(count, threads, [&](std::size_t begin, std::size_t end) {
+				detail::transform_aos<false>(m_data.data(), in + begin, out + begin, end - begin);
+			});
+		}
+
+		/// <summary>
+		/// Transforms an array of Point3s
+		/// </summary>
+		/// <param name="in">The points to transform</param>
+		/// <param name="out">Receives the transformed points. May be the same array as in.</param>
+		/// <param name="count">The amount of points</param>
+		/// <param name="threads">The most threads to split large arrays across. 0 uses every hardware thread.</param>
+		void apply(const Point3<T>* in, Point3<T>* out, const std::size_t count, const unsigned int threads = 1) const
+		{
+			detail::parallel_for(count, threads, [&](std::size_t begin, std::size_t end) {
+				detail::transform_aos<true>(m_data.data(), in + begin, out + begin, end - begin);
+			});
+		}
+
+		/// <summary>
+		/// Transforms an array of Vector3s. Vectors are not translated.
+		/// </summary>
+		/// <param name="in">The vectors to transform</param>
+		/// <param name="out">Receives the transformed vectors. May be the same array as in.</param>
+		/// <param name="count">The amount of vectors</param>
+		/// <param name="threads">The most threads to split large arrays across. 0 uses every hardware thread.</param>
+		void apply(const Vector3<T>* in, Vector3<T>* out, const std::size_t count, const unsigned int threads = 1) const
+		{
+			detail::parallel_for(count, threads, [&](std::size_t begin, std::size_t end) {
+				detail::transform_aos<false>(m_data.data(), in + begin, out + begin, end - begin);
+			});
+		}
+
+		/// <summary>
+		/// Transforms points stored as separate x, y and z arrays, several points at a time.
+		/// The output arrays may be the input arrays.
+		/// </summary>
+		/// <param name="count">The amount of points in each array</param>
+		/// <param name="threads">The most threads to split large arrays across. 0 uses every hardware thread.</param>
+		void apply(const T* x, const T* y, const T* z, T* outX, T* outY, T* outZ, const std::size_t count, const unsigned int threads = 1) const
+		{
+			detail::parallel_for(count, threads, [&](std::size_t begin, std::size_t end) {
+				detail::transform_soa<true>(m_data.data(), x + begin, y + begin, z + begin, outX + begin, outY + begin, outZ + begin, end - begin);
+			});
+		}
+
+		/// <summary>
+		/// Transforms vectors stored as separate x, y and z arrays, several vectors at a time.
+		/// Vectors are not translated. The output arrays may be the input arrays.
+		/// </summary>
+		/// <param name="count">The amount of vectors in each array</param>
+		/// <param name="threads">The most threads to split large arrays across. 0 uses every hardware thread.</param>
+		void apply_vectors(const T* x, const T* y, const T* z, T* outX, T* outY, T* outZ, const std::size_t count, const unsigned int threads = 1) const
+		{
+			detail::parallel_for(count, threads, [&](std::size_t begin, std::size_t end) {
+				detail::transform_soa<false>(m_data.data(), x + begin, y + begin, z + begin, outX + begin, outY + begin, outZ + begin, end - begin);
+			});
+		}
+
+		/// <summary>
+		/// The 12 numbers of the top three rows, row by row
+		/// </summary>
+		constexpr const T* data() const
+		{
+			return m_data.data();
+		}
+
+		constexpr T* data()
+		{
+			return m_data.data();
+		}
+
+		constexpr bool operator==(const Affine3& other) const
+		{
+			for (int i = 0; i < 12; ++i)
+			{
+				if (!equal<T>(m_data[i], other.m_data[i]))
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		constexpr bool operator!=(const Affine3& other) const
+		{
+			return !(*this == other);
+		}
+
+		friend std::ostream& operator<<(std::ostream& os, const Affine3& affine)
+		{
+			os << "3 x 4\n";
+
+			for (int row = 0; row < 3; ++row)
+			{
+				for (int col = 0; col < 4; ++col)
+				{
+					os << affine(row, col);
+
+					if (col != 3)
+					{
+						os << ", ";
+					}
+				}
+				os << "\n";
+			}
+
+			return os;
+		}
+	private:
+		std::array<T, 12> m_data;
+	};
+
+	/// <summary>
+	/// Transforms every point of in by an Affine3, writing the results to out. out may map the same memory as in.
+	/// </summary>
+	/// <param name="threads">The most threads to split large spans across. 0 uses every hardware thread.</param>
+	template<typename T, typename U>
+	void apply(const Affine3<T>& affine, const PointSpan<U>& in, const PointSpan<T>& out, const unsigned int threads = 1)
+	{
+		static_assert(std::is_same<std::remove_const_t<U>, T>::value, "Both spans must hold the type of the Affine3");
+
+		if (out.size() < in.size())
+		{
+			std::cerr << "Span is too small for the transformed points" << std::endl;
+			return;
+		}
+
+		detail::parallel_for(in.size(), threads, [&](std::size_t begin, std::size_t end) {
+			detail::transform_strided<true>(affine.data(), in.data() + begin * in.stride(), in.stride(), out.data() + begin * out.stride(), out.stride(), end - begin);
+		});
+	}
+}
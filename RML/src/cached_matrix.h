@@ -0,0 +1,127 @@
+#pragma once
+
+#include <optional>
+#include "matrix.h"
+
+namespace RML
+{
+	/// <summary>
+	/// A Matrix that remembers its determinant and inverse after they are first calculated.
+	/// Use this for matrices that are inverted many times between changes.
+	/// Matrix itself stores no cache, so it stays small and trivially copyable.
+	/// </summary>
+	/// <typeparam name="T">The type of number to store, e.g. int, float, double...</typeparam>
+	template<class T, int ROW, int COL>
+	class CachedMatrix
+	{
+	public:
+		/// <summary>
+		/// Creates a CachedMatrix with all data initialized to 0
+		/// </summary>
+		CachedMatrix() : m_matrix(), m_determinant(), m_inverted() {};
+
+		/// <summary>
+		/// Creates a CachedMatrix from a Matrix
+		/// </summary>
+		/// <param name="matrix">The Matrix to cache</param>
+		CachedMatrix(const Matrix<T, ROW, COL>& matrix) : m_matrix(matrix), m_determinant(), m_inverted() {};
+
+		/// <summary>
+		/// Replaces the Matrix and clears the cache
+		/// </summary>
+		/// <param name="matrix">The new Matrix</param>
+		CachedMatrix& operator=(const Matrix<T, ROW, COL>& matrix)
+		{
+			m_matrix = matrix;
+			clear();
+			return *this;
+		}
+
+		/// <summary>
+		/// Returns the cached Matrix
+		/// </summary>
+		const Matrix<T, ROW, COL>& matrix() const
+		{
+			return m_matrix;
+		}
+
+		operator const Matrix<T, ROW, COL>& () const
+		{
+			return m_matrix;
+		}
+
+		/// <summary>
+		/// Sets the value at row, column and clears the cache
+		/// </summary>
+		/// <param name="row">The row to set</param>
+		/// <param name="column">The column to set</param>
+		/// <param name="value">The new value</param>
+		void set(const int row, const int column, const T value)
+		{
+			m_matrix(row, column) = value;
+			clear();
+		}
+
+		/// <summary>
+		/// Subscript operator, accesses the value at row, column as readonly
+		/// </summary>
+		/// <param name="row">The row to access</param>
+		/// <param name="column">The column to access</param>
+		T operator() (const int row, const int column) const
+		{
+			return m_matrix(row, column);
+		}
+
+		/// <summary>
+		/// Calculates the determinant, or returns it from the cache
+		/// </summary>
+		/// <returns>The determinant</returns>
+		T determinant() const
+		{
+			if (!m_determinant)
+			{
+				m_determinant = m_matrix.determinant();
+			}
+
+			return *m_determinant;
+		}
+
+		/// <summary>
+		/// Checks if the Matrix can be inverted
+		/// </summary>
+		/// <returns>True if it can be inverted, else false</returns>
+		bool invertible() const
+		{
+			return determinant() != 0;
+		}
+
+		/// <summary>
+		/// Inverts the Matrix, or returns the inverse from the cache
+		/// </summary>
+		/// <returns>The inverted Matrix</returns>
+		const Matrix<T, ROW, COL>& invert() const
+		{
+			if (!m_inverted)
+			{
+				T determinant = 0;
+				m_inverted = m_matrix.invert(determinant);
+				m_determinant = determinant;
+			}
+
+			return *m_inverted;
+		}
+
+		/// <summary>
+		/// Forgets the cached determinant and inverse
+		/// </summary>
+		void clear()
+		{
+			m_determinant.reset();
+			m_inverted.reset();
+		}
+	private:
+		Matrix<T, ROW, COL> m_matrix;
+		mutable std::optional<T> m_determinant;
+		mutable std::optional<Matrix<T, ROW, COL>> m_inverted;
+	};
+}
@@ -15,20 +15,24 @@ namespace RML {
 	/// <param name="rhs">Right hand side argument</param>
 	/// <returns>True if equal (within EPSILON), False otherwise</returns>
 	template<typename T>
-	bool equal(const T lhs, const T rhs)
+	constexpr bool equal(const T lhs, const T rhs)
 	{
-		if (std::is_floating_point<T>::value)
+		if constexpr (std::is_floating_point<T>::value)
 		{
-			if (std::isinf((double)lhs) && std::isinf((double)rhs))
+			const bool lhsInfinite = lhs == INF || lhs == -INF;
+			const bool rhsInfinite = rhs == INF || rhs == -INF;
+
+			if (lhsInfinite && rhsInfinite)
 			{
-				return (lhs == INF && rhs == INF) || (lhs == -INF && rhs == -INF);
+				return lhs == rhs;
 			}
 
-			return abs(lhs - rhs) < EPSILON;
+			const T difference = lhs - rhs;
+
+			return (difference < 0 ? -difference : difference) < EPSILON;
 		}
 		else
 		{
 			return lhs == rhs;
 		}
-	};
-}
+	};}
@@ -0,0 +1,10 @@
+#pragma once
+
+// Define RML_HEADER_ONLY to compile the whole library from its headers.
+// Every function is then visible to the caller, so the optimizer can inline and vectorize through it without LTO.
+// By default the non-template functions are compiled once into the RML library.
+#if defined(RML_HEADER_ONLY)
+	#define RML_INLINE inline
+#else
+	#define RML_INLINE
+#endif
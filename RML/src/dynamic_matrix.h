@@ -0,0 +1,582 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iostream>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "comparison.h"
+#include "gemm.h"
+#include "lu.h"
+#include "matrix.h"
+#include "storage.h"
+
+namespace RML
+{
+	/// <summary>
+	/// A Matrix whose size is chosen at runtime, with its data on the heap.
+	/// Has the same interface as Matrix, but shape mismatches are reported when they happen instead of at compile time.
+	/// Moving a DynamicMatrix only passes its data on, and leaves the source as a 0 x 0 DynamicMatrix.
+	/// </summary>
+	template<typename T>
+	class DynamicMatrix
+	{
+	public:
+		/// <summary>
+		/// Creates a 0 x 0 DynamicMatrix
+		/// </summary>
+		DynamicMatrix() : m_rows(0), m_columns(0), m_data() {}
+
+		/// <summary>
+		/// Creates a DynamicMatrix
+		/// Initializes all data to 0.
+		/// </summary>
+		/// <param name="rows">The amount of rows in the Matrix</param>
+		/// <param name="columns">The amount of columns in the Matrix</param>
+		DynamicMatrix(const int rows, const int columns)
+			: m_rows(std::max(rows, 0)), m_columns(std::max(columns, 0)), m_data(allocate(m_rows, m_columns))
+		{
+		}
+
+		/// <summary>
+		/// Creates a DynamicMatrix
+		/// Initializes all data to the value of initialData, row by row
+		/// </summary>
+		/// <param name="rows">The amount of rows in the Matrix</param>
+		/// <param name="columns">The amount of columns in the Matrix</param>
+		/// <param name="initialData">List of data used to initialize the Matrix</param>
+		DynamicMatrix(const int rows, const int columns, std::initializer_list<T> initialData)
+			: DynamicMatrix(rows, columns)
+		{
+			if (initialData.size() != size())
+			{
+				std::cerr << "Matrix initial data size mismatch" << std::endl;
+			}
+
+			std::copy_n(initialData.begin(), std::min(initialData.size(), size()), m_data.get());
+		}
+
+		/// <summary>
+		/// Creates a DynamicMatrix with the size and data of a Matrix
+		/// </summary>
+		template<int ROW, int COL, Layout LAYOUT>
+		DynamicMatrix(const Matrix<T, ROW, COL, LAYOUT>& matrix)
+			: DynamicMatrix(ROW, COL)
+		{
+			if constexpr (LAYOUT == Layout::RowMajor)
+			{
+				std::copy_n(matrix.data(), size(), m_data.get());
+			}
+			else
+			{
+				for (int row = 0; row < ROW; ++row)
+				{
+					for (int col = 0; col < COL; ++col)
+					{
+						m_data[indexAt(row, col)] = matrix(row, col);
+					}
+				}
+			}
+		}
+
+		DynamicMatrix(const DynamicMatrix& other)
+			: DynamicMatrix(other.m_rows, other.m_columns)
+		{
+			std::copy_n(other.m_data.get(), size(), m_data.get());
+		}
+
+		DynamicMatrix(DynamicMatrix&& other) noexcept
+			: m_rows(std::exchange(other.m_rows, 0)), m_columns(std::exchange(other.m_columns, 0)), m_data(std::move(other.m_data))
+		{
+		}
+
+		DynamicMatrix& operator=(const DynamicMatrix& other)
+		{
+			if (this != &other)
+			{
+				// The allocation is kept when it already has the right size
+				if (size() != other.size())
+				{
+					m_data = allocate(other.m_rows, other.m_columns);
+				}
+
+				m_rows = other.m_rows;
+				m_columns = other.m_columns;
+
+				std::copy_n(other.m_data.get(), size(), m_data.get());
+			}
+
+			return *this;
+		}
+
+		DynamicMatrix& operator=(DynamicMatrix&& other) noexcept
+		{
+			if (this != &other)
+			{
+				m_rows = std::exchange(other.m_rows, 0);
+				m_columns = std::exchange(other.m_columns, 0);
+				m_data = std::move(other.m_data);
+			}
+
+			return *this;
+		}
+
+		/// <summary>
+		/// Creates a square Identity Matrix of a specific size
+		/// </summary>
+		/// <param name="size">The size of the matrix</param>
+		/// <returns>A square Identity Matrix of n x n size</returns>
+		static DynamicMatrix identity(const int size)
+		{
+			DynamicMatrix matrix(size, size);
+
+			for (int i = 0; i < size; ++i)
+			{
+				matrix(i, i) = 1;
+			}
+
+			return matrix;
+		}
+
+		int rows() const { return m_rows; }
+		int columns() const { return m_columns; }
+
+		/// <summary>
+		/// The amount of values in the Matrix
+		/// </summary>
+		std::size_t size() const
+		{
+			return static_cast<std::size_t>(m_rows) * m_columns;
+		}
+
+		/// <summary>
+		/// Subscript operator, accesses the value at row, column
+		/// </summary>
+		/// <param name="row">The row to access</param>
+		/// <param name="column">The column to access</param>
+		T& operator() (const int row, const int column)
+		{
+			return m_data[indexAt(row, column)];
+		}
+
+		/// <summary>
+		/// Subscript operator, accesses the value at row, column as readonly
+		/// </summary>
+		/// <param name="row">The row to access</param>
+		/// <param name="column">The column to access</param>
+		T operator() (const int row, const int column) const
+		{
+			return m_data[indexAt(row, column)];
+		}
+
+		/// <summary>
+		/// Transposes the Matrix, changing its rows into columns, and columns into rows
+		/// </summary>
+		/// <returns>A Matrix with transposed elements</returns>
+		DynamicMatrix transpose() const
+		{
+			DynamicMatrix result(m_columns, m_rows);
+
+			for (int row = 0; row < m_rows; ++row)
+			{
+				for (int col = 0; col < m_columns; ++col)
+				{
+					result(col, row) = m_data[indexAt(row, col)];
+				}
+			}
+
+			return result;
+		}
+
+		/// <summary>
+		/// Returns a copy of the Matrix, with the row and column removed.
+		/// </summary>
+		/// <param name="removeRow">The row to remove</param>
+		/// <param name="removeColumn">The column to remove</param>
+		/// <returns>The submatrix</returns>
+		DynamicMatrix submatrix(const int removeRow, const int removeColumn) const
+		{
+			if (m_rows <= 1 || m_columns <= 1)
+			{
+				std::cerr << "Matrix is too small to have a submatrix" << std::endl;
+				return DynamicMatrix();
+			}
+
+			DynamicMatrix result(m_rows - 1, m_columns - 1);
+
+			T* out = result.m_data.get();
+
+			for (int row = 0; row < m_rows; ++row)
+			{
+				for (int col = 0; col < m_columns; ++col)
+				{
+					if (col == removeColumn || row == removeRow) continue;
+
+					*out++ = m_data[indexAt(row, col)];
+				}
+			}
+
+			return result;
+		}
+
+		/// <summary>
+		/// Calculates the determinant of the square Matrix
+		/// </summary>
+		/// <returns>The determinant, or 0 if the Matrix is not square</returns>
+		T determinant() const
+		{
+			if (m_rows != m_columns)
+			{
+				std::cerr << "Matrix has an undefined determinant! Rows: " << m_rows << ", Cols: " << m_columns << std::endl;
+				return 0;
+			}
+
+			if (m_rows == 0)
+			{
+				return 1;
+			}
+
+			if constexpr (std::is_floating_point<T>::value)
+			{
+				std::vector<int> pivots(m_rows);
+				DynamicMatrix lu(*this);
+
+				const int sign = detail::lu_decompose(lu.data(), pivots.data(), m_rows);
+
+				T result = static_cast<T>(sign);
+
+				for (int i = 0; i < m_rows && sign != 0; ++i)
+				{
+					result *= lu(i, i);
+				}
+
+				return result;
+			}
+			else
+			{
+				return bareiss_determinant();
+			}
+		}
+
+		/// <summary>
+		/// Calculates the minor / determinant of the square submatrix.
+		/// </summary>
+		/// <param name="removeRow">The row to remove</param>
+		/// <param name="removeColumn">The column to remove</param>
+		/// <returns>The determinant of the submatrix</returns>
+		T minor(const int removeRow, const int removeColumn) const
+		{
+			return submatrix(removeRow, removeColumn).determinant();
+		}
+
+		/// <summary>
+		/// Calculates the cofactor of the square Matrix
+		/// </summary>
+		/// <param name="removeRow">The row to remove</param>
+		/// <param name="removeColumn">The column to remove</param>
+		/// <returns>The cofactor of the Matrix</returns>
+		T cofactor(const int removeRow, const int removeColumn) const
+		{
+			T result = minor(removeRow, removeColumn);
+
+			if ((removeRow + removeColumn) % 2 == 1)
+			{
+				result = -result;
+			}
+
+			return result;
+		}
+
+		/// <summary>
+		/// Checks if the Matrix can be inverted
+		/// </summary>
+		/// <returns>True if it can be inverted, else false</returns>
+		bool invertible() const
+		{
+			return m_rows == m_columns && determinant() != 0;
+		}
+
+		/// <summary>
+		/// Creates a copy of the Matrix that is inverted
+		/// </summary>
+		/// <returns>The inverted Matrix</returns>
+		DynamicMatrix invert() const
+		{
+			T determinant = 0;
+			return invert(determinant);
+		}
+
+		/// <summary>
+		/// Creates a copy of the Matrix that is inverted, and outputs the determinant calculated along the way.
+		/// The determinant is 0 if the Matrix is not invertible, in which case a copy of the Matrix is returned.
+		/// </summary>
+		/// <param name="determinant">Set to the determinant of the Matrix</param>
+		/// <returns>The inverted Matrix</returns>
+		DynamicMatrix invert(T& determinant) const
+		{
+			determinant = 0;
+
+			if (m_rows != m_columns)
+			{
+				std::cerr << "Only a square Matrix can be inverted" << std::endl;
+				return *this;
+			}
+
+			const int n = m_rows;
+			DynamicMatrix result(n, n);
+
+			if constexpr (std::is_floating_point<T>::value)
+			{
+				std::vector<int> pivots(n);
+				DynamicMatrix lu(*this);
+
+				const int sign = detail::lu_decompose(lu.data(), pivots.data(), n);
+
+				if (sign != 0)
+				{
+					determinant = static_cast<T>(sign);
+
+					for (int i = 0; i < n; ++i)
+					{
+						determinant *= lu(i, i);
+					}
+
+					const DynamicMatrix rhs = identity(n);
+
+					detail::lu_permute(rhs.data(), pivots.data(), n, n, result.data());
+					detail::lu_solve(lu.data(), n, result.data(), n);
+				}
+			}
+			else
+			{
+				determinant = this->determinant();
+
+				if (determinant != 0)
+				{
+					if (n == 1)
+					{
+						result(0, 0) = 1 / determinant;
+					}
+					else
+					{
+						for (int row = 0; row < n; ++row)
+						{
+							for (int col = 0; col < n; ++col)
+							{
+								result(col, row) = cofactor(row, col) / determinant;
+							}
+						}
+					}
+				}
+			}
+
+			if (determinant == 0)
+			{
+				std::cerr << "Matrix is not invertible" << std::endl;
+				return *this;
+			}
+
+			return result;
+		}
+
+		/// <summary>
+		/// Multiplies the Matrix with another
+		/// </summary>
+		/// <returns>The product, or a 0 x 0 Matrix if the columns of this Matrix do not match the rows of other</returns>
+		DynamicMatrix operator*(const DynamicMatrix& other) const
+		{
+			return multiply(other, matrix_threads());
+		}
+
+		/// <summary>
+		/// Multiplies the Matrix with another, using at most threads threads when the product is large enough to be split
+		/// </summary>
+		/// <param name="other">The right hand side</param>
+		/// <param name="threads">The most threads to use. 0 uses one thread per hardware thread.</param>
+		/// <returns>The product, or a 0 x 0 Matrix if the columns of this Matrix do not match the rows of other</returns>
+		DynamicMatrix multiply(const DynamicMatrix& other, const unsigned int threads) const
+		{
+			if (m_columns != other.m_rows)
+			{
+				std::cerr << "Matrix has an undefined product" << std::endl;
+				return DynamicMatrix();
+			}
+
+			DynamicMatrix result(m_rows, other.m_columns);
+
+			if (size() * other.m_columns >= detail::GEMM_MIN_MULTIPLICATIONS)
+			{
+				detail::gemm(data(), other.data(), result.data(), m_rows, m_columns, other.m_columns, threads);
+				return result;
+			}
+
+			for (int row = 0; row < m_rows; ++row)
+			{
+				for (int col = 0; col < other.m_columns; ++col)
+				{
+					T value = 0;
+
+					for (int i = 0; i < m_columns; ++i)
+					{
+						value += m_data[indexAt(row, i)] * other(i, col);
+					}
+
+					result(row, col) = value;
+				}
+			}
+
+			return result;
+		}
+
+		bool operator==(const DynamicMatrix& other) const
+		{
+			if (m_rows != other.m_rows || m_columns != other.m_columns)
+			{
+				return false;
+			}
+
+			for (std::size_t i = 0; i < size(); ++i)
+			{
+				if (!equal<T>(m_data[i], other.m_data[i]))
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		bool operator!=(const DynamicMatrix& other) const
+		{
+			return !(*this == other);
+		}
+
+		friend std::ostream& operator<<(std::ostream& os, const DynamicMatrix& matrix)
+		{
+			os << matrix.m_rows << " x " << matrix.m_columns << "\n";
+
+			for (int row = 0; row < matrix.m_rows; ++row)
+			{
+				for (int col = 0; col < matrix.m_columns; ++col)
+				{
+					os << matrix(row, col);
+
+					if (col != matrix.m_columns - 1)
+					{
+						os << ", ";
+					}
+				}
+				os << "\n";
+			}
+
+			return os;
+		}
+
+		/// <summary>
+		/// Converts to a Matrix of the same size, e.g. static_cast&lt;Matrix&lt;double, 4, 4&gt;&gt;(dynamicMatrix)
+		/// </summary>
+		/// <returns>The Matrix, or a zero Matrix if the sizes do not match</returns>
+		template<int ROW, int COL, Layout LAYOUT>
+		explicit operator Matrix<T, ROW, COL, LAYOUT>() const
+		{
+			Matrix<T, ROW, COL, LAYOUT> result;
+
+			if (m_rows != ROW || m_columns != COL)
+			{
+				std::cerr << "Matrix size mismatch! Rows: " << m_rows << ", Cols: " << m_columns << std::endl;
+				return result;
+			}
+
+			if constexpr (LAYOUT == Layout::RowMajor)
+			{
+				std::copy_n(data(), size(), result.data());
+			}
+			else
+			{
+				for (int row = 0; row < ROW; ++row)
+				{
+					for (int col = 0; col < COL; ++col)
+					{
+						result(row, col) = m_data[indexAt(row, col)];
+					}
+				}
+			}
+
+			return result;
+		}
+
+		const T* data() const
+		{
+			return m_data.get();
+		}
+
+		T* data()
+		{
+			return m_data.get();
+		}
+	private:
+		int m_rows;
+		int m_columns;
+		detail::AlignedPtr<T> m_data;
+
+		static detail::AlignedPtr<T> allocate(const int rows, const int columns)
+		{
+			const std::size_t count = static_cast<std::size_t>(rows) * columns;
+
+			return count > 0 ? detail::aligned_zeroed<T>(count) : detail::AlignedPtr<T>();
+		}
+
+		int indexAt(const int row, const int column) const
+		{
+			return row * m_columns + column;
+		}
+
+		/// <summary>
+		/// Calculates the determinant of a square integer Matrix without division remainders,
+		/// using fraction-free (Bareiss) elimination, so it stays exact and takes n^3 steps instead of n!.
+		/// </summary>
+		T bareiss_determinant() const
+		{
+			const int n = m_rows;
+			DynamicMatrix a(*this);
+
+			T sign = 1;
+			T previous = 1;
+
+			for (int k = 0; k < n - 1; ++k)
+			{
+				if (a(k, k) == 0)
+				{
+					int swapRow = k + 1;
+
+					while (swapRow < n && a(swapRow, k) == 0)
+					{
+						++swapRow;
+					}
+
+					if (swapRow == n)
+					{
+						return 0;
+					}
+
+					std::swap_ranges(a.data() + k * n, a.data() + k * n + n, a.data() + swapRow * n);
+					sign = -sign;
+				}
+
+				for (int row = k + 1; row < n; ++row)
+				{
+					for (int col = k + 1; col < n; ++col)
+					{
+						a(row, col) = (a(row, col) * a(k, k) - a(row, k) * a(k, col)) / previous;
+					}
+				}
+
+				previous = a(k, k);
+			}
+
+			return sign * a(n - 1, n - 1);
+		}
+	};
+}
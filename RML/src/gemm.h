@@ -0,0 +1,220 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include "parallel.h"
+#include "simd.h"
+
+namespace RML
+{
+	namespace detail
+	{
+		inline std::atomic<unsigned int> g_matrixThreads{ 0 };
+	}
+
+	/// <summary>
+	/// Sets the most threads a large Matrix product may use. 0, the default, uses one thread per hardware thread.
+	/// </summary>
+	/// <param name="threads">The most threads to use</param>
+	inline void set_matrix_threads(const unsigned int threads)
+	{
+		detail::g_matrixThreads = threads;
+	}
+
+	/// <summary>
+	/// Returns the most threads a large Matrix product may use. 0 uses one thread per hardware thread.
+	/// </summary>
+	inline unsigned int matrix_threads()
+	{
+		return detail::g_matrixThreads;
+	}
+}
+
+/// <summary>
+/// Cache blocked, register tiled product of row-major matrices, for sizes where the plain loop runs out of cache.
+/// </summary>
+namespace RML::detail
+{
+	/// <summary>
+	/// Products with at least this many multiplications use gemm instead of the plain loop
+	/// </summary>
+	constexpr std::size_t GEMM_MIN_MULTIPLICATIONS = 32 * 32 * 32;
+
+	/// <summary>
+	/// The fewest multiplications worth handing to a thread of its own
+	/// </summary>
+	constexpr std::size_t GEMM_PARALLEL_MIN_MULTIPLICATIONS = 1 << 20;
+
+	// Each step of the micro kernel updates a GEMM_MR x gemm_nr<T>() tile of the result held in registers.
+	// GEMM_KC rows of b by GEMM_NC columns are worked through at a time, so they stay in cache while every row of a passes over them.
+	constexpr int GEMM_MR = 4;
+	constexpr int GEMM_KC = 128;
+	constexpr int GEMM_NC = 256;
+
+	template<typename T>
+	constexpr int gemm_nr()
+	{
+		return Pack<T>::WIDTH > 1 ? 2 * Pack<T>::WIDTH : 4;
+	}
+
+	/// <summary>
+	/// Adds the product of an mr x kc block of a and a kc x nr block of b to the same sized block of c.
+	/// Handles the blocks at the edges, which are smaller than a full tile.
+	/// </summary>
+	template<typename T>
+	void gemm_edge(const T* a, const int lda, const T* b, const int ldb, T* c, const int ldc, const int mr, const int nr, const int kc)
+	{
+		for (int row = 0; row < mr; ++row)
+		{
+			for (int p = 0; p < kc; ++p)
+			{
+				const T value = a[row * lda + p];
+
+				for (int col = 0; col < nr; ++col)
+				{
+					c[row * ldc + col] += value * b[p * ldb + col];
+				}
+			}
+		}
+	}
+
+	/// <summary>
+	/// Adds the product of a GEMM_MR x kc block of a and a kc x gemm_nr block of b to the same sized block of c,
+	/// keeping the block of c in registers throughout.
+	/// </summary>
+	template<typename T>
+	void gemm_tile(const T* a, const int lda, const T* b, const int ldb, T* c, const int ldc, const int kc)
+	{
+		constexpr int NR = gemm_nr<T>();
+
+		if constexpr (Pack<T>::WIDTH > 1)
+		{
+			using P = Pack<T>;
+			constexpr int W = P::WIDTH;
+
+			typename P::Register acc[GEMM_MR][2];
+
+			for (int row = 0; row < GEMM_MR; ++row)
+			{
+				acc[row][0] = P::load(c + row * ldc);
+				acc[row][1] = P::load(c + row * ldc + W);
+			}
+
+			for (int p = 0; p < kc; ++p)
+			{
+				const typename P::Register b0 = P::load(b + p * ldb);
+				const typename P::Register b1 = P::load(b + p * ldb + W);
+
+				for (int row = 0; row < GEMM_MR; ++row)
+				{
+					const typename P::Register value = P::set1(a[row * lda + p]);
+
+					acc[row][0] = P::add(acc[row][0], P::mul(value, b0));
+					acc[row][1] = P::add(acc[row][1], P::mul(value, b1));
+				}
+			}
+
+			for (int row = 0; row < GEMM_MR; ++row)
+			{
+				P::store(c + row * ldc, acc[row][0]);
+				P::store(c + row * ldc + W, acc[row][1]);
+			}
+		}
+		else
+		{
+			T acc[GEMM_MR][NR];
+
+			for (int row = 0; row < GEMM_MR; ++row)
+			{
+				for (int col = 0; col < NR; ++col)
+				{
+					acc[row][col] = c[row * ldc + col];
+				}
+			}
+
+			for (int p = 0; p < kc; ++p)
+			{
+				for (int row = 0; row < GEMM_MR; ++row)
+				{
+					const T value = a[row * lda + p];
+
+					for (int col = 0; col < NR; ++col)
+					{
+						acc[row][col] += value * b[p * ldb + col];
+					}
+				}
+			}
+
+			for (int row = 0; row < GEMM_MR; ++row)
+			{
+				for (int col = 0; col < NR; ++col)
+				{
+					c[row * ldc + col] = acc[row][col];
+				}
+			}
+		}
+	}
+
+	/// <summary>
+	/// Calculates rows [rowBegin, rowEnd) of c = a * b
+	/// </summary>
+	template<typename T>
+	void gemm_rows(const T* a, const T* b, T* c, const int k, const int n, const int rowBegin, const int rowEnd)
+	{
+		constexpr int NR = gemm_nr<T>();
+
+		std::fill(c + rowBegin * n, c + rowEnd * n, T(0));
+
+		for (int jc = 0; jc < n; jc += GEMM_NC)
+		{
+			const int nc = std::min(GEMM_NC, n - jc);
+
+			for (int pc = 0; pc < k; pc += GEMM_KC)
+			{
+				const int kc = std::min(GEMM_KC, k - pc);
+
+				for (int i = rowBegin; i < rowEnd; i += GEMM_MR)
+				{
+					const int mr = std::min(GEMM_MR, rowEnd - i);
+
+					for (int j = jc; j < jc + nc; j += NR)
+					{
+						const int nr = std::min(NR, jc + nc - j);
+
+						const T* aBlock = a + i * k + pc;
+						const T* bBlock = b + pc * n + j;
+						T* cBlock = c + i * n + j;
+
+						if (mr == GEMM_MR && nr == NR)
+						{
+							gemm_tile(aBlock, k, bBlock, n, cBlock, n, kc);
+						}
+						else
+						{
+							gemm_edge(aBlock, k, bBlock, n, cBlock, n, mr, nr, kc);
+						}
+					}
+				}
+			}
+		}
+	}
+
+	/// <summary>
+	/// Calculates c = a * b, for a m x k matrix a and a k x n matrix b, all row-major.
+	/// The rows of c are split across threads when there is enough work for each.
+	/// </summary>
+	/// <param name="c">Receives the m x n product. Must not alias a or b.</param>
+	/// <param name="threads">The most threads to use. 0 uses one thread per hardware thread.</param>
+	template<typename T>
+	void gemm(const T* a, const T* b, T* c, const int m, const int k, const int n, const unsigned int threads)
+	{
+		const std::size_t rowMultiplications = static_cast<std::size_t>(k) * n;
+		const std::size_t minRows = std::max<std::size_t>(GEMM_MR, GEMM_PARALLEL_MIN_MULTIPLICATIONS / std::max<std::size_t>(1, rowMultiplications));
+
+		parallel_for(static_cast<std::size_t>(m), threads, [=](const std::size_t begin, const std::size_t end)
+		{
+			gemm_rows(a, b, c, k, n, static_cast<int>(begin), static_cast<int>(end));
+		}, minRows);
+	}
+}
@@ -0,0 +1,242 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include "matrix.h"
+#include "tuple4.h"
+
+namespace RML
+{
+	namespace detail
+	{
+		/// <summary>
+		/// Factorizes a row-major n x n matrix in place into L and U with partial pivoting.
+		/// L has an implicit unit diagonal and is stored below the diagonal, U on and above it.
+		/// </summary>
+		/// <param name="a">The n x n matrix to factorize. Overwritten with L and U.</param>
+		/// <param name="pivots">Receives the original row index of each row after pivoting</param>
+		/// <param name="n">The size of the matrix</param>
+		/// <returns>The sign of the row permutation (1 or -1), or 0 if the matrix is singular</returns>
+		template<typename T>
+		int lu_decompose(T* a, int* pivots, const int n)
+		{
+			int sign = 1;
+
+			for (int i = 0; i < n; ++i)
+			{
+				pivots[i] = i;
+			}
+
+			for (int k = 0; k < n; ++k)
+			{
+				int pivotRow = k;
+				T pivotValue = std::abs(a[k * n + k]);
+
+				for (int row = k + 1; row < n; ++row)
+				{
+					const T value = std::abs(a[row * n + k]);
+
+					if (value > pivotValue)
+					{
+						pivotValue = value;
+						pivotRow = row;
+					}
+				}
+
+				if (pivotValue == 0)
+				{
+					return 0;
+				}
+
+				if (pivotRow != k)
+				{
+					std::swap_ranges(a + k * n, a + k * n + n, a + pivotRow * n);
+					std::swap(pivots[k], pivots[pivotRow]);
+					sign = -sign;
+				}
+
+				const T* pivot = a + k * n;
+
+				for (int row = k + 1; row < n; ++row)
+				{
+					T* target = a + row * n;
+
+					const T factor = target[k] / pivot[k];
+					target[k] = factor;
+
+					for (int col = k + 1; col < n; ++col)
+					{
+						target[col] -= factor * pivot[col];
+					}
+				}
+			}
+
+			return sign;
+		}
+
+		/// <summary>
+		/// Copies the rows of b into the order chosen by the pivots of lu_decompose.
+		/// </summary>
+		/// <param name="b">The row-major n x cols right hand side</param>
+		/// <param name="pivots">The pivots from lu_decompose</param>
+		/// <param name="n">The amount of rows in b</param>
+		/// <param name="cols">The amount of columns in b</param>
+		/// <param name="result">Receives the permuted rows of b</param>
+		template<typename T>
+		void lu_permute(const T* b, const int* pivots, const int n, const int cols, T* result)
+		{
+			for (int row = 0; row < n; ++row)
+			{
+				std::copy_n(b + pivots[row] * cols, cols, result + row * cols);
+			}
+		}
+
+		/// <summary>
+		/// Solves LU * x = b in place for a row-major n x cols right hand side,
+		/// where b has already been permuted by lu_permute.
+		/// </summary>
+		/// <param name="lu">The factorized matrix from lu_decompose</param>
+		/// <param name="n">The size of the factorized matrix</param>
+		/// <param name="b">The permuted right hand side. Overwritten with the solution.</param>
+		/// <param name="cols">The amount of columns in the right hand side</param>
+		template<typename T>
+		void lu_solve(const T* lu, const int n, T* b, const int cols)
+		{
+			// Forward substitution with the unit lower triangle
+			for (int row = 1; row < n; ++row)
+			{
+				for (int k = 0; k < row; ++k)
+				{
+					const T factor = lu[row * n + k];
+
+					for (int col = 0; col < cols; ++col)
+					{
+						b[row * cols + col] -= factor * b[k * cols + col];
+					}
+				}
+			}
+
+			// Back substitution with the upper triangle
+			for (int row = n - 1; row >= 0; --row)
+			{
+				for (int k = row + 1; k < n; ++k)
+				{
+					const T factor = lu[row * n + k];
+
+					for (int col = 0; col < cols; ++col)
+					{
+						b[row * cols + col] -= factor * b[k * cols + col];
+					}
+				}
+
+				const T diagonal = lu[row * n + row];
+
+				for (int col = 0; col < cols; ++col)
+				{
+					b[row * cols + col] /= diagonal;
+				}
+			}
+		}
+	}
+
+	/// <summary>
+	/// LU factorization of a square Matrix with partial pivoting.
+	/// Calculates the determinant, inverse and solutions to linear systems in O(N^3).
+	/// </summary>
+	/// <typeparam name="T">The floating point type of the Matrix</typeparam>
+	/// <typeparam name="N">The amount of rows and columns in the Matrix</typeparam>
+	template<class T, int N>
+	class LU
+	{
+	public:
+		static_assert(std::is_floating_point<T>::value, "LU requires a floating point type");
+
+		/// <summary>
+		/// Factorizes the Matrix
+		/// </summary>
+		/// <param name="matrix">The square Matrix to factorize</param>
+		LU(const Matrix<T, N, N>& matrix) : m_lu(), m_pivots(), m_sign(0)
+		{
+			std::copy_n(matrix.data(), N * N, m_lu.begin());
+			m_sign = detail::lu_decompose(m_lu.data(), m_pivots.data(), N);
+		}
+
+		/// <summary>
+		/// Checks if the factorized Matrix is singular, i.e. it cannot be inverted
+		/// </summary>
+		/// <returns>True if singular, else false</returns>
+		bool singular() const
+		{
+			return m_sign == 0;
+		}
+
+		/// <summary>
+		/// Calculates the determinant of the factorized Matrix
+		/// </summary>
+		/// <returns>The determinant</returns>
+		T determinant() const
+		{
+			if (singular())
+				return 0;
+
+			T result = static_cast<T>(m_sign);
+
+			for (int i = 0; i < N; ++i)
+			{
+				result *= m_lu[i * N + i];
+			}
+
+			return result;
+		}
+
+		/// <summary>
+		/// Solves matrix * x = rhs for x
+		/// </summary>
+		/// <param name="rhs">The right hand side, one system per column</param>
+		/// <returns>The solution x, or a zero Matrix if the factorized Matrix is singular</returns>
+		template<int COL>
+		Matrix<T, N, COL> solve(const Matrix<T, N, COL>& rhs) const
+		{
+			if (singular())
+			{
+				std::cerr << "Matrix is singular, the system has no unique solution" << std::endl;
+				return Matrix<T, N, COL>();
+			}
+
+			Matrix<T, N, COL> result;
+
+			detail::lu_permute(rhs.data(), m_pivots.data(), N, COL, result.data());
+			detail::lu_solve(m_lu.data(), N, result.data(), COL);
+
+			return result;
+		}
+
+		/// <summary>
+		/// Solves matrix * x = rhs for x, where the 4x4 system is given as a Tuple
+		/// </summary>
+		/// <param name="rhs">The right hand side</param>
+		/// <returns>The solution x, or a zero Tuple if the factorized Matrix is singular</returns>
+		Tuple4<T> solve(const Tuple4<T>& rhs) const
+		{
+			static_assert(N == 4, "Only a 4x4 system can be solved for a Tuple4");
+
+			Matrix<T, 4, 1> result = solve(Matrix<T, 4, 1>({ rhs.x(), rhs.y(), rhs.z(), rhs.w() }));
+
+			return Tuple4<T>(result(0, 0), result(1, 0), result(2, 0), result(3, 0));
+		}
+
+		/// <summary>
+		/// Calculates the inverse of the factorized Matrix
+		/// </summary>
+		/// <returns>The inverse, or a zero Matrix if the factorized Matrix is singular</returns>
+		Matrix<T, N, N> inverse() const
+		{
+			return solve(Matrix<T, N, N>::identity());
+		}
+	private:
+		detail::MatrixStorage<T, N * N> m_lu;
+		std::array<int, N> m_pivots;
+		int m_sign;
+	};
+}
@@ -1,28 +1,46 @@
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <iostream>
 #include <sstream>
 #include "tuple4.h"
 #include "comparison.h"
+#include "simd.h"
+#include "storage.h"
+#include "gemm.h"
 
 namespace RML
 {
+	template<class T, int N>
+	class LU;
+
+	/// <summary>
+	/// The order a Matrix keeps its numbers in memory
+	/// </summary>
+	enum class Layout
+	{
+		RowMajor,
+		ColumnMajor
+	};
+
 	/// <summary>
 	/// A Matrix of numbers
 	/// </summary>
 	/// <typeparam name="T">The type of number to store, e.g. int, float, double...</typeparam>
-	template<class T, int ROW, int COL>
+	/// <typeparam name="LAYOUT">The order of the numbers behind data(). operator() and every constructor use (row, column) order either way.</typeparam>
+	template<class T, int ROW, int COL, Layout LAYOUT = Layout::RowMajor>
 	class Matrix
 	{
 	public:
-		template<class T, int ROW2, int COL2>
+		template<class U, int ROW2, int COL2, Layout LAYOUT2>
 		friend class Matrix;
 
 		/// <summary>
 		/// Creates a Matrix
 		/// Initializes all data to 0.
 		/// </summary>
-		Matrix() : m_rows(ROW), m_columns(COL), m_data(std::array<T, ROW * COL>()) {
+		constexpr Matrix() : m_data() {
 			static_assert(ROW > 0, "ROW is too small");
 			static_assert(COL > 0, "COL is too small");
 		};
@@ -33,26 +51,45 @@ namespace RML
 		/// </summary>
 		/// <param name="rows">The amount of rows in the Matrix</param>
 		/// <param name="columns">The amount of columns in the Matrix</param>
-		/// <param name="initialData">List of data used to initialize the Matrix</param>
-		Matrix(std::array<T, ROW * COL> initialData) : m_rows(ROW), m_columns(COL), m_data(initialData) {
+		/// <param name="initialData">List of data used to initialize the Matrix, row by row whatever the layout</param>
+		constexpr Matrix(std::array<T, ROW * COL> initialData) : m_data(initialData) {
 			static_assert(ROW > 0, "ROW is too small");
 			static_assert(COL > 0, "COL is too small");
 
-			if (m_data.size() != m_rows * m_columns)
+			if constexpr (LAYOUT == Layout::ColumnMajor)
 			{
-				std::cerr << "Matrix initial data size mismatch" << std::endl;
+				for (int row = 0; row < ROW; ++row)
+				{
+					for (int col = 0; col < COL; ++col)
+					{
+						m_data[indexAt(row, col)] = initialData[row * COL + col];
+					}
+				}
 			}
 		};
 
-		// Allow Matrices to be converted between types
-		template<typename U>
-		Matrix(const Matrix<U, ROW, COL>& other)
-			: m_rows(ROW), m_columns(COL), m_data(std::array<T, ROW * COL>())
+		// Allow Matrices to be converted between types and layouts
+		template<typename U, Layout LAYOUT2>
+		constexpr Matrix(const Matrix<U, ROW, COL, LAYOUT2>& other)
+			: m_data()
 		{
-			std::copy_n(other.m_data.begin(), m_rows * m_columns, m_data.begin());
-			m_determinant = (T)other.m_determinant;
-			m_rows = other.m_rows;
-			m_columns = other.m_columns;
+			if constexpr (LAYOUT == LAYOUT2)
+			{
+				for (int i = 0; i < ROW * COL; ++i)
+				{
+					m_data[i] = static_cast<T>(other.m_data[i]);
+				}
+			}
+			else
+			{
+				for (int row = 0; row < ROW; ++row)
+				{
+					for (int col = 0; col < COL; ++col)
+					{
+						m_data[indexAt(row, col)] = static_cast<T>(other(row, col));
+					}
+				}
+			}
 		}
 
 		/// <summary>
@@ -60,9 +97,9 @@ namespace RML
 		/// </summary>
 		/// <param name="size">The size of the matrix</param>
 		/// <returns>A square Identity Matrix of n x n size</returns>
-		static Matrix<T, ROW, COL> identity()
+		static constexpr Matrix identity()
 		{
-			Matrix<T, ROW, COL> matrix;
+			Matrix matrix;
 
 			constexpr int size = ROW * COL;
 
@@ -82,7 +119,7 @@ namespace RML
 		/// </summary>
 		/// <param name="row">The row to access</param>
 		/// <param name="column">The column to access</param>
-		T& operator() (const int row, const int column)
+		constexpr T& operator() (const int row, const int column)
 		{
 			return m_data[indexAt(row, column)];
 		};
@@ -92,7 +129,7 @@ namespace RML
 		/// </summary>
 		/// <param name="row">The row to access</param>
 		/// <param name="column">The column to access</param>
-		T operator() (const int row, const int column) const
+		constexpr T operator() (const int row, const int column) const
 		{
 			return m_data[indexAt(row, column)];
 		};
@@ -101,12 +138,12 @@ namespace RML
 		/// Transposes the Matrix, changing its rows into columns, and columns into rows
 		/// </summary>
 		/// <returns>A Matrix with transposed elements</returns>
-		Matrix<T, COL, ROW> transpose() const
+		constexpr Matrix<T, COL, ROW, LAYOUT> transpose() const
 		{
 			constexpr int transposedColumns = ROW;
 			constexpr int transposedRows = COL;
 
-			Matrix<T, transposedRows, transposedColumns> result;
+			Matrix<T, transposedRows, transposedColumns, LAYOUT> result;
 
 			for (int row = 0; row < transposedRows; ++row)
 			{
@@ -119,46 +156,64 @@ namespace RML
 			return result;
 		}
 
-		auto submatrix(const int removeRow, const int removeColumn) const;
+		constexpr auto submatrix(const int removeRow, const int removeColumn) const;
 
 		/// <summary>
 		/// Calculates the determinant of the square Matrix
 		/// </summary>
 		/// <returns>The determinant</returns>
-		T determinant() const
+		constexpr T determinant() const
 		{
-			if (m_determinant != 0)
-				return m_determinant;
+			static_assert(ROW == COL, "Only a square Matrix has a determinant");
+
+			constexpr int MATRIX_SIZE = ROW;
+
+			if constexpr (MATRIX_SIZE == 1)
+			{
+				return m_data[0];
+			}
+			else if constexpr (MATRIX_SIZE == 2)
+			{
+				return m_data[indexAt(0, 0)] * m_data[indexAt(1, 1)] - m_data[indexAt(1, 0)] * m_data[indexAt(0, 1)];
+			}
+			else if constexpr (MATRIX_SIZE == 3)
+			{
+				const auto& m = m_data;
 
-			if constexpr (ROW != COL)
+				return m[0] * (m[4] * m[8] - m[5] * m[7])
+					+ m[1] * (m[5] * m[6] - m[3] * m[8])
+					+ m[2] * (m[3] * m[7] - m[4] * m[6]);
+			}
+			else if constexpr (MATRIX_SIZE == 4)
+			{
+				const auto& m = m_data;
+
+				T result =
+					  (m[0] * m[5] - m[4] * m[1]) * (m[10] * m[15] - m[14] * m[11])
+					- (m[0] * m[6] - m[4] * m[2]) * (m[9] * m[15] - m[13] * m[11])
+					+ (m[0] * m[7] - m[4] * m[3]) * (m[9] * m[14] - m[13] * m[10])
+					+ (m[1] * m[6] - m[5] * m[2]) * (m[8] * m[15] - m[12] * m[11])
+					- (m[1] * m[7] - m[5] * m[3]) * (m[8] * m[14] - m[12] * m[10])
+					+ (m[2] * m[7] - m[6] * m[3]) * (m[8] * m[13] - m[12] * m[9]);
+
+				return result;
+			}
+			else if constexpr (std::is_floating_point<T>::value)
 			{
-				std::cerr << "Matrix has an undefined determinant! Rows: " << m_rows << ", Cols: " << m_columns << std::endl;
-				return 0;
+				T result = LU<T, MATRIX_SIZE>(*this).determinant();
+
+				return result;
 			}
 			else
 			{
-				constexpr int MATRIX_SIZE = ROW;
+				T result = 0;
 
-				if constexpr (MATRIX_SIZE == 1)
-				{
-					return m_data[0];
-				}
-				else if constexpr (MATRIX_SIZE == 2)
+				for (int col = 0; col < COL; ++col)
 				{
-					return m_data[indexAt(0, 0)] * m_data[indexAt(1, 1)] - m_data[indexAt(1, 0)] * m_data[indexAt(0, 1)];
+					result += cofactor(0, col) * m_data[indexAt(0, col)];
 				}
-				else
-				{
-					T result = 0;
-
-					for (int col = 0; col < m_columns; ++col)
-					{
-						result += cofactor(0, col) * m_data[indexAt(0, col)];
-					}
 
-					m_determinant = result;
-					return result;
-				}
+				return result;
 			}
 		}
 
@@ -168,7 +223,7 @@ namespace RML
 		/// <param name="removeRow">The row to remove</param>
 		/// <param name="removeColumn">The column to remove</param>
 		/// <returns>The determinant of the submatrix</returns>
-		T minor(const int removeRow, const int removeColumn) const
+		constexpr T minor(const int removeRow, const int removeColumn) const
 		{
 			return submatrix(removeRow, removeColumn).determinant();
 		}
@@ -179,7 +234,7 @@ namespace RML
 		/// <param name="removeRow">The row to remove</param>
 		/// <param name="removeColumn">The column to remove</param>
 		/// <returns>The cofactor of the Matrix</returns>
-		T cofactor(const int removeRow, const int removeColumn) const
+		constexpr T cofactor(const int removeRow, const int removeColumn) const
 		{
 			T result = minor(removeRow, removeColumn);
 
@@ -195,7 +250,7 @@ namespace RML
 		/// Checks if the Matrix can be inverted
 		/// </summary>
 		/// <returns>True if it can be inverted, else false</returns>
-		bool invertible() const
+		constexpr bool invertible() const
 		{
 			return determinant() != 0;
 		}
@@ -204,48 +259,223 @@ namespace RML
 		/// Creates a copy of the Matrix that is inverted
 		/// </summary>
 		/// <returns>The inverted Matrix</returns>
-		Matrix invert() const
+		constexpr Matrix invert() const
 		{
-			if (m_inverted)
+			T determinant = 0;
+			return invert(determinant);
+		}
+
+		/// <summary>
+		/// Creates a copy of the Matrix that is inverted, and outputs the determinant calculated along the way.
+		/// The determinant is 0 if the Matrix is not invertible, in which case a copy of the Matrix is returned.
+		/// </summary>
+		/// <param name="determinant">Set to the determinant of the Matrix</param>
+		/// <returns>The inverted Matrix</returns>
+		constexpr Matrix invert(T& determinant) const
+		{
+			static_assert(ROW == COL, "Only a square Matrix can be inverted");
+
+			// The closed forms work on the numbers as stored. A column-major Matrix is stored as its transpose,
+			// and the inverse of the transpose is the transpose of the inverse, so they suit both layouts.
+			Matrix result;
+
+			if constexpr (ROW == 1)
 			{
-				return *m_inverted;
-			}
+				determinant = m_data[0];
 
-			if (!invertible())
+				if (determinant != 0)
+				{
+					result.m_data[0] = 1 / determinant;
+				}
+			}
+			else if constexpr (ROW == 3 || ROW == 4)
 			{
-				std::cerr << "Matrix is not invertible" << std::endl;
-				return *this;
+				result = invert_closed_form(determinant);
 			}
+			else if constexpr (ROW >= 5 && std::is_floating_point<T>::value)
+			{
+				LU<T, ROW> lu(*this);
 
-			Matrix<T, ROW, COL> result;
+				determinant = lu.determinant();
 
-			for (int row = 0; row < m_rows; ++row)
+				if (determinant != 0)
+				{
+					result = lu.inverse();
+				}
+			}
+			else
 			{
-				for (int col = 0; col < m_columns; ++col)
+				determinant = this->determinant();
+
+				if (determinant != 0)
 				{
-					T c = cofactor(row, col);
+					for (int row = 0; row < ROW; ++row)
+					{
+						for (int col = 0; col < COL; ++col)
+						{
+							T c = cofactor(row, col);
 
-					result(col, row) = c / determinant();
+							result(col, row) = c / determinant;
+						}
+					}
 				}
 			}
 
-			m_inverted = std::make_shared<Matrix<T, COL, ROW>>(result);
+			if (determinant == 0)
+			{
+				std::cerr << "Matrix is not invertible" << std::endl;
+				return *this;
+			}
 
 			return result;
 		}
 
+		/// <summary>
+		/// Creates a copy of an affine 4x4 Matrix that is inverted, i.e. one whose bottom row is 0, 0, 0, 1.
+		/// Only the upper 3x3 part is inverted, and the translation is transformed back by it.
+		/// </summary>
+		/// <returns>The inverted Matrix, or a copy of the Matrix if it is not invertible</returns>
+		constexpr Matrix affine_inverse() const
+		{
+			static_assert(ROW == 4 && COL == 4, "Only a 4x4 Matrix can have an affine inverse");
+
+			if constexpr (LAYOUT == Layout::ColumnMajor)
+			{
+				return Matrix(Matrix<T, 4, 4>(*this).affine_inverse());
+			}
+
+			const auto& m = m_data;
+
+			const T c00 = m[5] * m[10] - m[6] * m[9];
+			const T c01 = m[6] * m[8] - m[4] * m[10];
+			const T c02 = m[4] * m[9] - m[5] * m[8];
+
+			const T determinant = m[0] * c00 + m[1] * c01 + m[2] * c02;
+
+			if (determinant == 0)
+			{
+				std::cerr << "Matrix is not invertible" << std::endl;
+				return *this;
+			}
+
+			const T a = c00 / determinant;
+			const T b = (m[2] * m[9] - m[1] * m[10]) / determinant;
+			const T c = (m[1] * m[6] - m[2] * m[5]) / determinant;
+			const T d = c01 / determinant;
+			const T e = (m[0] * m[10] - m[2] * m[8]) / determinant;
+			const T f = (m[2] * m[4] - m[0] * m[6]) / determinant;
+			const T g = c02 / determinant;
+			const T h = (m[1] * m[8] - m[0] * m[9]) / determinant;
+			const T i = (m[0] * m[5] - m[1] * m[4]) / determinant;
+
+			const T x = m[3], y = m[7], z = m[11];
+
+			return Matrix({
+				a, b, c, -(a * x + b * y + c * z),
+				d, e, f, -(d * x + e * y + f * z),
+				g, h, i, -(g * x + h * y + i * z),
+				0, 0, 0, 1
+			});
+		}
+
+		/// <summary>
+		/// Creates a copy of a rigid 4x4 Matrix that is inverted, i.e. one that only rotates and translates.
+		/// The rotation is inverted by transposing it, so the result is wrong for any other Matrix.
+		/// </summary>
+		/// <returns>The inverted Matrix</returns>
+		constexpr Matrix rigid_inverse() const
+		{
+			static_assert(ROW == 4 && COL == 4, "Only a 4x4 Matrix can have a rigid inverse");
+
+			if constexpr (LAYOUT == Layout::ColumnMajor)
+			{
+				return Matrix(Matrix<T, 4, 4>(*this).rigid_inverse());
+			}
+
+			const auto& m = m_data;
+			const T x = m[3], y = m[7], z = m[11];
+
+			return Matrix({
+				m[0], m[4], m[8],  -(m[0] * x + m[4] * y + m[8] * z),
+				m[1], m[5], m[9],  -(m[1] * x + m[5] * y + m[9] * z),
+				m[2], m[6], m[10], -(m[2] * x + m[6] * y + m[10] * z),
+				0,    0,    0,     1
+			});
+		}
+
 		template<int ROW2, int COL2>
-		Matrix<T, ROW, COL2> operator*(const Matrix<T, ROW2, COL2> & other) const
+		constexpr Matrix<T, ROW, COL2, LAYOUT> operator*(const Matrix<T, ROW2, COL2, LAYOUT> & other) const
 		{
-			if (this->m_columns != other.m_rows)
+			static_assert(COL == ROW2, "Matrix has an undefined product, the columns of the left hand side must match the rows of the right hand side");
+
+			const int newRows = ROW;
+			const int newColumns = COL2;
+
+			Matrix<T, ROW, COL2, LAYOUT> result;
+
+			// A column-major product is stored as the row-major product of the transposes in reverse order, (A * B)^T = B^T * A^T,
+			// so the row-major kernels are called with the sides swapped
+			constexpr bool ROW_MAJOR = LAYOUT == Layout::RowMajor;
+			const T* lhs = ROW_MAJOR ? m_data.data() : other.m_data.data();
+			const T* rhs = ROW_MAJOR ? other.m_data.data() : m_data.data();
+
+			if constexpr (ROW == 4 && COL == 4 && ROW2 == 4 && COL2 == 4)
 			{
-				std::cerr << "Matrix has an undefined product" << std::endl;
+				if (detail::is_constant_evaluated())
+				{
+					detail::multiply4x4_scalar(lhs, rhs, result.m_data.data());
+				}
+				else
+				{
+					detail::multiply4x4(lhs, rhs, result.m_data.data());
+				}
+
+				return result;
 			}
+			else if constexpr (ROW == 4 && COL == 4 && COL2 == 1)
+			{
+				// A 4x1 Matrix is laid out like a Tuple4 in either layout
+				if constexpr (ROW_MAJOR)
+				{
+					if (detail::is_constant_evaluated())
+					{
+						detail::multiply4x4_tuple_scalar(m_data.data(), other.m_data.data(), result.m_data.data());
+					}
+					else
+					{
+						detail::multiply4x4_tuple(m_data.data(), other.m_data.data(), result.m_data.data());
+					}
+				}
+				else
+				{
+					if (detail::is_constant_evaluated())
+					{
+						detail::multiply4x4_columns_tuple_scalar(m_data.data(), other.m_data.data(), result.m_data.data());
+					}
+					else
+					{
+						detail::multiply4x4_columns_tuple(m_data.data(), other.m_data.data(), result.m_data.data());
+					}
+				}
 
-			const int newRows = m_rows;
-			const int newColumns = other.m_columns;
+				return result;
+			}
+			else if constexpr (static_cast<std::size_t>(ROW) * COL * COL2 >= detail::GEMM_MIN_MULTIPLICATIONS)
+			{
+				if (!detail::is_constant_evaluated())
+				{
+					if constexpr (ROW_MAJOR)
+					{
+						detail::gemm(lhs, rhs, result.m_data.data(), ROW, COL, COL2, matrix_threads());
+					}
+					else
+					{
+						detail::gemm(lhs, rhs, result.m_data.data(), COL2, COL, ROW, matrix_threads());
+					}
 
-			Matrix<T, ROW, COL2> result;
+					return result;
+				}
+			}
 
 			for (int row = 0; row < newRows; ++row)
 			{
@@ -253,7 +483,7 @@ namespace RML
 				{
 					T value = 0;
 
-					for (int i = 0; i < m_columns; ++i)
+					for (int i = 0; i < COL; ++i)
 					{
 						value += this->m_data[indexAt(row, i)] * other(i, col);
 					}
@@ -265,41 +495,130 @@ namespace RML
 			return result;
 		};
 
-		Tuple4<T> operator*(const Tuple4<T>& tuple) const
+		/// <summary>
+		/// Multiplies the 4x4 Matrix with a Tuple, treating the Tuple as a column
+		/// </summary>
+		/// <param name="tuple">The Tuple to multiply</param>
+		/// <returns>The product as a Tuple</returns>
+		constexpr Tuple4<T> operator*(const Tuple4<T>& tuple) const
 		{
-			Matrix<T, 4, 1> matrix({
-				tuple.x(),
-				tuple.y(),
-				tuple.z(),
-				tuple.w()
-			});
+			static_assert(ROW == 4 && COL == 4, "Only a 4x4 Matrix can be multiplied with a Tuple4");
 
-			matrix = *this * matrix;
+			const T column[4] = { tuple.x(), tuple.y(), tuple.z(), tuple.w() };
+			T result[4] = {};
 
-			Tuple4 result(
-				matrix(0,0),
-				matrix(0,1),
-				matrix(0,2),
-				matrix(0,3)
-			);
+			if constexpr (LAYOUT == Layout::RowMajor)
+			{
+				if (detail::is_constant_evaluated())
+				{
+					detail::multiply4x4_tuple_scalar(m_data.data(), column, result);
+				}
+				else
+				{
+					detail::multiply4x4_tuple(m_data.data(), column, result);
+				}
+			}
+			else
+			{
+				if (detail::is_constant_evaluated())
+				{
+					detail::multiply4x4_columns_tuple_scalar(m_data.data(), column, result);
+				}
+				else
+				{
+					detail::multiply4x4_columns_tuple(m_data.data(), column, result);
+				}
+			}
 
-			return result;
+			return Tuple4<T>(result[0], result[1], result[2], result[3]);
 		}
 
-		template<typename T, int ROW2, int COL2>
-		bool operator==(const Matrix<T, ROW2, COL2>& other) const
+		/// <summary>
+		/// Transforms a point by an affine 4x4 Matrix, i.e. one whose bottom row is 0, 0, 0, 1.
+		/// The w component is taken to be 1, so the bottom row is skipped.
+		/// </summary>
+		/// <param name="point">The point to transform</param>
+		/// <returns>The transformed point, with w set to 1</returns>
+		constexpr Tuple4<T> transform_point(const Tuple4<T>& point) const
 		{
-			if (other.m_data.size() != this->m_data.size())
+			static_assert(ROW == 4 && COL == 4, "Only a 4x4 Matrix can transform a point");
+
+			const auto& m = m_data;
+			const T x = point.x(), y = point.y(), z = point.z();
+
+			if constexpr (LAYOUT == Layout::ColumnMajor)
 			{
-				return false;
+				return Tuple4<T>(
+					m[0] * x + m[4] * y + m[8] * z + m[12],
+					m[1] * x + m[5] * y + m[9] * z + m[13],
+					m[2] * x + m[6] * y + m[10] * z + m[14],
+					1
+				);
 			}
 
-			if (this->m_rows != other.m_rows && this->m_columns != other.m_columns)
+			return Tuple4<T>(
+				m[0] * x + m[1] * y + m[2] * z + m[3],
+				m[4] * x + m[5] * y + m[6] * z + m[7],
+				m[8] * x + m[9] * y + m[10] * z + m[11],
+				1
+			);
+		}
+
+		/// <summary>
+		/// Transforms a vector by an affine 4x4 Matrix, i.e. one whose bottom row is 0, 0, 0, 1.
+		/// The w component is taken to be 0, so the bottom row and the translation column are skipped.
+		/// </summary>
+		/// <param name="vector">The vector to transform</param>
+		/// <returns>The transformed vector, with w set to 0</returns>
+		constexpr Tuple4<T> transform_vector(const Tuple4<T>& vector) const
+		{
+			static_assert(ROW == 4 && COL == 4, "Only a 4x4 Matrix can transform a vector");
+
+			const auto& m = m_data;
+			const T x = vector.x(), y = vector.y(), z = vector.z();
+
+			if constexpr (LAYOUT == Layout::ColumnMajor)
+			{
+				return Tuple4<T>(
+					m[0] * x + m[4] * y + m[8] * z,
+					m[1] * x + m[5] * y + m[9] * z,
+					m[2] * x + m[6] * y + m[10] * z,
+					0
+				);
+			}
+
+			return Tuple4<T>(
+				m[0] * x + m[1] * y + m[2] * z,
+				m[4] * x + m[5] * y + m[6] * z,
+				m[8] * x + m[9] * y + m[10] * z,
+				0
+			);
+		}
+
+		template<typename U, int ROW2, int COL2, Layout LAYOUT2>
+		constexpr bool operator==(const Matrix<U, ROW2, COL2, LAYOUT2>& other) const
+		{
+			if constexpr (ROW != ROW2 || COL != COL2)
 			{
 				return false;
 			}
+			else if constexpr (LAYOUT != LAYOUT2)
+			{
+				for (int row = 0; row < ROW; ++row)
+				{
+					for (int col = 0; col < COL; ++col)
+					{
+						if (!equal<T>((*this)(row, col), other(row, col)))
+						{
+							return false;
+						}
+					}
+				}
 
-			for (int i = 0; i < this->m_data.size(); ++i)
+				return true;
+			}
+
+			for (int i = 0; i < ROW * COL; ++i)
 			{
 				if (!equal<T>(this->m_data[i], other.m_data[i]))
 				{
@@ -310,22 +629,22 @@ namespace RML
 			return true;
 		};
 
-		bool operator!=(const Matrix& other) const
+		constexpr bool operator!=(const Matrix& other) const
 		{
 			return !(*this == other);
 		};
 
 		friend std::ostream& operator<<(std::ostream& os, const Matrix& matrix)
 		{
-			os << matrix.m_rows << " x " << matrix.m_columns << "\n";
+			os << ROW << " x " << COL << "\n";
 
-			for (int row = 0; row < matrix.m_rows; ++row)
+			for (int row = 0; row < ROW; ++row)
 			{
-				for (int col = 0; col < matrix.m_columns; ++col)
+				for (int col = 0; col < COL; ++col)
 				{
 					os << matrix(row, col);
 
-					if (col != matrix.m_columns - 1)
+					if (col != COL - 1)
 					{
 						os << ", ";
 					}
@@ -336,20 +655,141 @@ namespace RML
 			return os;
 		}
 
-		const T* const data() const
+		/// <summary>
+		/// Multiplies the Matrix with another, using at most threads threads when the product is large enough to be split
+		/// </summary>
+		/// <param name="other">The right hand side</param>
+		/// <param name="threads">The most threads to use. 0 uses one thread per hardware thread.</param>
+		/// <returns>The product</returns>
+		template<int ROW2, int COL2>
+		Matrix<T, ROW, COL2, LAYOUT> multiply(const Matrix<T, ROW2, COL2, LAYOUT>& other, const unsigned int threads) const
+		{
+			static_assert(COL == ROW2, "Matrix has an undefined product, the columns of the left hand side must match the rows of the right hand side");
+
+			Matrix<T, ROW, COL2, LAYOUT> result;
+
+			if constexpr (LAYOUT == Layout::RowMajor)
+			{
+				detail::gemm(m_data.data(), other.m_data.data(), result.m_data.data(), ROW, COL, COL2, threads);
+			}
+			else
+			{
+				detail::gemm(other.m_data.data(), m_data.data(), result.m_data.data(), COL2, COL, ROW, threads);
+			}
+
+			return result;
+		}
+
+		/// <summary>
+		/// The numbers of the Matrix in the order of LAYOUT, e.g. ready to upload to a graphics API that expects column-major matrices
+		/// </summary>
+		constexpr const T* const data() const
 		{
-			return reinterpret_cast<const T* const>(&m_data);
+			return m_data.data();
+		}
+
+		constexpr T* data()
+		{
+			return m_data.data();
 		}
 	private:
-		int m_rows, m_columns;
-		mutable T m_determinant = 0;
-		mutable std::shared_ptr<Matrix<T, ROW, COL>> m_inverted = nullptr;
-		std::array<T, ROW * COL> m_data;
+		// Large matrices keep their data on the heap, see RML_MATRIX_HEAP_BYTES
+		detail::MatrixStorage<T, ROW * COL> m_data;
 
-		int indexAt(const int row, const int column) const
+		constexpr int indexAt(const int row, const int column) const
 		{
-			return row * m_columns + column;
+			if constexpr (LAYOUT == Layout::RowMajor)
+			{
+				return row * COL + column;
+			}
+			else
+			{
+				return column * ROW + row;
+			}
 		};
+
+		/// <summary>
+		/// Inverts a 3x3 or 4x4 Matrix in closed form.
+		/// The 2x2 sub-determinants are shared between the determinant and the adjugate,
+		/// so the determinant is only calculated once.
+		/// </summary>
+		/// <param name="determinant">Set to the determinant of the Matrix</param>
+		/// <returns>The inverted Matrix, or a zero Matrix if the determinant is 0</returns>
+		constexpr Matrix invert_closed_form(T& determinant) const
+		{
+			const auto& m = m_data;
+			Matrix result;
+
+			if constexpr (ROW == 3)
+			{
+				const T c00 = m[4] * m[8] - m[5] * m[7];
+				const T c01 = m[5] * m[6] - m[3] * m[8];
+				const T c02 = m[3] * m[7] - m[4] * m[6];
+
+				determinant = m[0] * c00 + m[1] * c01 + m[2] * c02;
+
+				if (determinant == 0)
+					return result;
+
+				result.m_data = {
+					c00, m[2] * m[7] - m[1] * m[8], m[1] * m[5] - m[2] * m[4],
+					c01, m[0] * m[8] - m[2] * m[6], m[2] * m[3] - m[0] * m[5],
+					c02, m[1] * m[6] - m[0] * m[7], m[0] * m[4] - m[1] * m[3]
+				};
+			}
+			else
+			{
+				// 2x2 determinants of the top two rows
+				const T s0 = m[0] * m[5] - m[4] * m[1];
+				const T s1 = m[0] * m[6] - m[4] * m[2];
+				const T s2 = m[0] * m[7] - m[4] * m[3];
+				const T s3 = m[1] * m[6] - m[5] * m[2];
+				const T s4 = m[1] * m[7] - m[5] * m[3];
+				const T s5 = m[2] * m[7] - m[6] * m[3];
+
+				// 2x2 determinants of the bottom two rows
+				const T c5 = m[10] * m[15] - m[14] * m[11];
+				const T c4 = m[9] * m[15] - m[13] * m[11];
+				const T c3 = m[9] * m[14] - m[13] * m[10];
+				const T c2 = m[8] * m[15] - m[12] * m[11];
+				const T c1 = m[8] * m[14] - m[12] * m[10];
+				const T c0 = m[8] * m[13] - m[12] * m[9];
+
+				determinant = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+
+				if (determinant == 0)
+					return result;
+
+				result.m_data = {
+					m[5] * c5 - m[6] * c4 + m[7] * c3,
+					-m[1] * c5 + m[2] * c4 - m[3] * c3,
+					m[13] * s5 - m[14] * s4 + m[15] * s3,
+					-m[9] * s5 + m[10] * s4 - m[11] * s3,
+
+					-m[4] * c5 + m[6] * c2 - m[7] * c1,
+					m[0] * c5 - m[2] * c2 + m[3] * c1,
+					-m[12] * s5 + m[14] * s2 - m[15] * s1,
+					m[8] * s5 - m[10] * s2 + m[11] * s1,
+
+					m[4] * c4 - m[5] * c2 + m[7] * c0,
+					-m[0] * c4 + m[1] * c2 - m[3] * c0,
+					m[12] * s4 - m[13] * s2 + m[15] * s0,
+					-m[8] * s4 + m[9] * s2 - m[11] * s0,
+
+					-m[4] * c3 + m[5] * c1 - m[6] * c0,
+					m[0] * c3 - m[1] * c1 + m[2] * c0,
+					-m[12] * s3 + m[13] * s1 - m[14] * s0,
+					m[8] * s3 - m[9] * s1 + m[10] * s0
+				};
+			}
+
+			for (auto& value : result.m_data)
+			{
+				value = value / determinant;
+			}
+
+			return result;
+		}
 	};
 
 	/// <summary>
@@ -358,37 +798,39 @@ namespace RML
 	/// <param name="removeRow">The row to remove</param>
 	/// <param name="removeColumn">The column to remove</param>
 	/// <returns>The submatrix</returns>
-	template<typename T, int ROW, int COL>
-	auto Matrix<T, ROW, COL>::submatrix(const int removeRow, const int removeColumn) const
+	template<typename T, int ROW, int COL, Layout LAYOUT>
+	constexpr auto Matrix<T, ROW, COL, LAYOUT>::submatrix(const int removeRow, const int removeColumn) const
 	{
-		if constexpr (ROW <= 1 || COL <= 1)
-		{
-			std::cerr << "Matrix submatrix is too small. Returning 1x1 Matrix." << std::endl;
-			return Matrix<T, 1, 1>();
-		}
-		else
-		{
-			constexpr int NEW_ROW = ROW - 1;
-			constexpr int NEW_COL = COL - 1;
+		static_assert(ROW > 1 && COL > 1, "Matrix is too small to have a submatrix");
 
-			std::array<T, NEW_ROW * NEW_COL> data{ -1 };
+		constexpr int NEW_ROW = ROW - 1;
+		constexpr int NEW_COL = COL - 1;
 
-			int i = 0;
+		std::array<T, NEW_ROW * NEW_COL> data{ -1 };
 
-			for (int row = 0; row < m_rows; ++row)
+		int i = 0;
+
+		for (int row = 0; row < ROW; ++row)
+		{
+			for (int col = 0; col < COL; ++col)
 			{
-				for (int col = 0; col < m_columns; ++col)
-				{
-					if (col == removeColumn || row == removeRow) continue;
+				if (col == removeColumn || row == removeRow) continue;
 
-					data.at(i) = m_data[indexAt(row, col)];
-					++i;
-				}
+				data[i] = m_data[indexAt(row, col)];
+				++i;
 			}
+		}
 
-			Matrix<T, NEW_ROW, NEW_COL> result(data);
+		Matrix<T, NEW_ROW, NEW_COL, LAYOUT> result(data);
 
-			return result;
-		}
+		return result;
 	}
+
+	/// <summary>
+	/// A Matrix that keeps its numbers column by column, as OpenGL and Vulkan expect them
+	/// </summary>
+	template<class T, int ROW, int COL>
+	using ColMajorMatrix = Matrix<T, ROW, COL, Layout::ColumnMajor>;
 }
+
+#include "lu.h"
@@ -0,0 +1,323 @@
+#pragma once
+
+#include <type_traits>
+#include "matrix.h"
+
+/// <summary>
+/// Opt-in expression templates for Matrix arithmetic.
+/// Wrap a Matrix with lazy() and the products, sums and transposes built from it are only
+/// evaluated when the expression is assigned to a Matrix, e.g.
+///     Matrix<double, 4, 1> result = lazy(projection) * view * model * position;
+/// Chains of products are reordered by shape before they are evaluated, so the example above
+/// multiplies position through each Matrix instead of multiplying the 4x4 matrices together.
+/// Expressions refer to the matrices they were built from, so evaluate them before those matrices go away.
+/// </summary>
+namespace RML::expr
+{
+	/// <summary>
+	/// Base of every expression. E is the expression type itself.
+	/// </summary>
+	template<class E>
+	class Expression
+	{
+	public:
+		/// <summary>
+		/// Evaluates the expression into a Matrix
+		/// </summary>
+		template<typename T, int ROW, int COL>
+		operator Matrix<T, ROW, COL>() const
+		{
+			static_assert(ROW == E::ROWS && COL == E::COLS, "Expression has a different shape to the Matrix it is assigned to");
+
+			return static_cast<const E&>(*this).evaluate();
+		}
+	};
+
+	template<class E>
+	constexpr bool is_expression = std::is_base_of<Expression<E>, E>::value;
+
+	/// <summary>
+	/// Refers to a Matrix without copying it
+	/// </summary>
+	template<typename T, int ROW, int COL>
+	class Leaf : public Expression<Leaf<T, ROW, COL>>
+	{
+	public:
+		using Type = T;
+		static constexpr int ROWS = ROW;
+		static constexpr int COLS = COL;
+		static constexpr bool ELEMENTWISE = true;
+
+		explicit Leaf(const Matrix<T, ROW, COL>& matrix) : m_matrix(matrix) {}
+
+		T operator()(const int row, const int column) const
+		{
+			return m_matrix(row, column);
+		}
+
+		const Matrix<T, ROW, COL>& evaluate() const
+		{
+			return m_matrix;
+		}
+	private:
+		const Matrix<T, ROW, COL>& m_matrix;
+	};
+
+	/// <summary>
+	/// Evaluates an expression whose elements can each be calculated on their own
+	/// </summary>
+	template<class E>
+	Matrix<typename E::Type, E::ROWS, E::COLS> evaluate_elementwise(const E& expression)
+	{
+		Matrix<typename E::Type, E::ROWS, E::COLS> result;
+
+		for (int row = 0; row < E::ROWS; ++row)
+		{
+			for (int col = 0; col < E::COLS; ++col)
+			{
+				result(row, col) = expression(row, col);
+			}
+		}
+
+		return result;
+	}
+
+	/// <summary>
+	/// Adds or subtracts two expressions of the same shape
+	/// </summary>
+	template<class L, class R, bool SUBTRACT>
+	class Sum : public Expression<Sum<L, R, SUBTRACT>>
+	{
+	public:
+		static_assert(L::ROWS == R::ROWS && L::COLS == R::COLS, "Matrix has an undefined sum, both sides must have the same shape");
+
+		using Type = typename L::Type;
+		static constexpr int ROWS = L::ROWS;
+		static constexpr int COLS = L::COLS;
+		static constexpr bool ELEMENTWISE = L::ELEMENTWISE && R::ELEMENTWISE;
+
+		Sum(const L& lhs, const R& rhs) : m_lhs(lhs), m_rhs(rhs) {}
+
+		Type operator()(const int row, const int column) const
+		{
+			if constexpr (SUBTRACT)
+			{
+				return m_lhs(row, column) - m_rhs(row, column);
+			}
+			else
+			{
+				return m_lhs(row, column) + m_rhs(row, column);
+			}
+		}
+
+		Matrix<Type, ROWS, COLS> evaluate() const
+		{
+			if constexpr (ELEMENTWISE)
+			{
+				return evaluate_elementwise(*this);
+			}
+			else
+			{
+				// A product on either side is evaluated once, instead of once per element
+				const auto& lhs = m_lhs.evaluate();
+				const auto& rhs = m_rhs.evaluate();
+
+				return evaluate_elementwise(Sum<Leaf<Type, ROWS, COLS>, Leaf<Type, ROWS, COLS>, SUBTRACT>(
+					Leaf<Type, ROWS, COLS>(lhs), Leaf<Type, ROWS, COLS>(rhs)));
+			}
+		}
+	private:
+		L m_lhs;
+		R m_rhs;
+	};
+
+	/// <summary>
+	/// Swaps the rows and columns of an expression
+	/// </summary>
+	template<class E>
+	class Transpose : public Expression<Transpose<E>>
+	{
+	public:
+		using Type = typename E::Type;
+		static constexpr int ROWS = E::COLS;
+		static constexpr int COLS = E::ROWS;
+		static constexpr bool ELEMENTWISE = E::ELEMENTWISE;
+
+		explicit Transpose(const E& expression) : m_expression(expression) {}
+
+		Type operator()(const int row, const int column) const
+		{
+			return m_expression(column, row);
+		}
+
+		Matrix<Type, ROWS, COLS> evaluate() const
+		{
+			if constexpr (ELEMENTWISE)
+			{
+				return evaluate_elementwise(*this);
+			}
+			else
+			{
+				return m_expression.evaluate().transpose();
+			}
+		}
+	private:
+		E m_expression;
+	};
+
+	/// <summary>
+	/// Multiplies two expressions
+	/// </summary>
+	template<class L, class R>
+	class Product : public Expression<Product<L, R>>
+	{
+	public:
+		static_assert(L::COLS == R::ROWS, "Matrix has an undefined product, the columns of the left hand side must match the rows of the right hand side");
+
+		using Type = typename L::Type;
+		static constexpr int ROWS = L::ROWS;
+		static constexpr int COLS = R::COLS;
+		static constexpr bool ELEMENTWISE = false;
+
+		using Lhs = L;
+		using Rhs = R;
+
+		Product(const L& lhs, const R& rhs) : m_lhs(lhs), m_rhs(rhs) {}
+
+		const L& lhs() const { return m_lhs; }
+		const R& rhs() const { return m_rhs; }
+
+		Matrix<Type, ROWS, COLS> evaluate() const;
+	private:
+		L m_lhs;
+		R m_rhs;
+	};
+
+	template<class E>
+	struct is_product : std::false_type {};
+
+	template<class L, class R>
+	struct is_product<Product<L, R>> : std::true_type {};
+
+	/// <summary>
+	/// The amount of multiplications needed for (A * B) * C and A * (B * C),
+	/// where A is a x b, B is b x c and C is c x d
+	/// </summary>
+	constexpr int left_first_cost(const int a, const int b, const int c, const int d) { return a * b * c + a * c * d; }
+	constexpr int right_first_cost(const int a, const int b, const int c, const int d) { return b * c * d + a * b * d; }
+
+	/// <summary>
+	/// Checks if (A * B) * C, where L is A * B and R is C, is cheaper as A * (B * C)
+	/// </summary>
+	template<class L, class R>
+	constexpr bool cheaper_right_first()
+	{
+		if constexpr (is_product<L>::value)
+		{
+			using A = typename L::Lhs;
+			using B = typename L::Rhs;
+
+			return right_first_cost(A::ROWS, A::COLS, B::COLS, R::COLS) < left_first_cost(A::ROWS, A::COLS, B::COLS, R::COLS);
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	/// <summary>
+	/// Checks if A * (B * C), where L is A and R is B * C, is cheaper as (A * B) * C
+	/// </summary>
+	template<class L, class R>
+	constexpr bool cheaper_left_first()
+	{
+		if constexpr (is_product<R>::value)
+		{
+			using B = typename R::Lhs;
+			using C = typename R::Rhs;
+
+			return left_first_cost(L::ROWS, L::COLS, B::COLS, C::COLS) < right_first_cost(L::ROWS, L::COLS, B::COLS, C::COLS);
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	template<class L, class R>
+	Matrix<typename Product<L, R>::Type, Product<L, R>::ROWS, Product<L, R>::COLS> Product<L, R>::evaluate() const
+	{
+		if constexpr (cheaper_right_first<L, R>())
+		{
+			using BC = Product<typename L::Rhs, R>;
+			return Product<typename L::Lhs, BC>(m_lhs.lhs(), BC(m_lhs.rhs(), m_rhs)).evaluate();
+		}
+		else if constexpr (cheaper_left_first<L, R>())
+		{
+			using AB = Product<L, typename R::Lhs>;
+			return Product<AB, typename R::Rhs>(AB(m_lhs, m_rhs.lhs()), m_rhs.rhs()).evaluate();
+		}
+		else
+		{
+			const auto& lhs = m_lhs.evaluate();
+			const auto& rhs = m_rhs.evaluate();
+
+			return lhs * rhs;
+		}
+	}
+
+	/// <summary>
+	/// Starts an expression from a Matrix
+	/// </summary>
+	template<typename T, int ROW, int COL>
+	Leaf<T, ROW, COL> lazy(const Matrix<T, ROW, COL>& matrix)
+	{
+		return Leaf<T, ROW, COL>(matrix);
+	}
+
+	template<class E, typename = std::enable_if_t<is_expression<E>>>
+	const E& as_expression(const E& expression)
+	{
+		return expression;
+	}
+
+	template<typename T, int ROW, int COL>
+	Leaf<T, ROW, COL> as_expression(const Matrix<T, ROW, COL>& matrix)
+	{
+		return Leaf<T, ROW, COL>(matrix);
+	}
+
+	template<class E>
+	using as_expression_t = std::decay_t<decltype(as_expression(std::declval<const E&>()))>;
+
+	// The operators need at least one side to be an expression, so products of two plain matrices stay eager
+	template<class L, class R>
+	constexpr bool either_expression = is_expression<L> || is_expression<R>;
+
+	template<class L, class R, typename = std::enable_if_t<either_expression<L, R>>>
+	Product<as_expression_t<L>, as_expression_t<R>> operator*(const L& lhs, const R& rhs)
+	{
+		return { as_expression(lhs), as_expression(rhs) };
+	}
+
+	template<class L, class R, typename = std::enable_if_t<either_expression<L, R>>>
+	Sum<as_expression_t<L>, as_expression_t<R>, false> operator+(const L& lhs, const R& rhs)
+	{
+		return { as_expression(lhs), as_expression(rhs) };
+	}
+
+	template<class L, class R, typename = std::enable_if_t<either_expression<L, R>>>
+	Sum<as_expression_t<L>, as_expression_t<R>, true> operator-(const L& lhs, const R& rhs)
+	{
+		return { as_expression(lhs), as_expression(rhs) };
+	}
+
+	/// <summary>
+	/// Transposes an expression without copying it
+	/// </summary>
+	template<class E, typename = std::enable_if_t<is_expression<E>>>
+	Transpose<E> transpose(const E& expression)
+	{
+		return Transpose<E>(expression);
+	}
+}
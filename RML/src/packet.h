@@ -0,0 +1,481 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+#include "matrix.h"
+#include "quaternion.h"
+#include "trig.h"
+#include "vec.h"
+#include "vector3.h"
+#include "simd.h"
+
+namespace RML
+{
+	template<typename T, std::size_t W>
+	class Packet;
+
+	/// <summary>
+	/// The result of comparing two Packets: one flag per lane.
+	/// </summary>
+	template<typename T, std::size_t W>
+	class PacketMask
+	{
+		using P = detail::PackOrScalar<T>;
+		static constexpr std::size_t REGISTERS = W / P::WIDTH;
+
+	public:
+		/// <summary>
+		/// Returns a mask with every lane set to value
+		/// </summary>
+		static PacketMask all_lanes(const bool value)
+		{
+			const Packet<T, W> zero;
+			return value ? zero == zero : zero != zero;
+		}
+
+		PacketMask operator&(const PacketMask& other) const
+		{
+			PacketMask result;
+
+			for (std::size_t i = 0; i < REGISTERS; ++i)
+			{
+				result.m_mask[i] = P::mask_and(m_mask[i], other.m_mask[i]);
+			}
+
+			return result;
+		}
+
+		PacketMask operator|(const PacketMask& other) const
+		{
+			PacketMask result;
+
+			for (std::size_t i = 0; i < REGISTERS; ++i)
+			{
+				result.m_mask[i] = P::mask_or(m_mask[i], other.m_mask[i]);
+			}
+
+			return result;
+		}
+
+		PacketMask operator!() const
+		{
+			PacketMask result;
+
+			for (std::size_t i = 0; i < REGISTERS; ++i)
+			{
+				result.m_mask[i] = P::mask_not(m_mask[i]);
+			}
+
+			return result;
+		}
+
+		/// <summary>
+		/// Returns one bit per lane, lane 0 in the lowest bit
+		/// </summary>
+		unsigned int bits() const
+		{
+			unsigned int result = 0;
+
+			for (std::size_t i = 0; i < REGISTERS; ++i)
+			{
+				result |= static_cast<unsigned int>(P::mask_bits(m_mask[i])) << (i * P::WIDTH);
+			}
+
+			return result;
+		}
+
+		bool operator[](const std::size_t lane) const
+		{
+			return (bits() >> lane) & 1u;
+		}
+
+		bool any() const { return bits() != 0; }
+		bool all() const { return bits() == (1u << W) - 1; }
+		bool none() const { return bits() == 0; }
+	private:
+		friend class Packet<T, W>;
+
+		typename P::Mask m_mask[REGISTERS];
+	};
+
+	/// <summary>
+	/// W numbers of type T that are worked on together, one lane each.
+	/// The lanes fill as many SIMD registers as they need: a Packet<float, 8> is one AVX register, two SSE registers, or 8 numbers without SIMD.
+	/// </summary>
+	template<typename T, std::size_t W>
+	class Packet
+	{
+		using P = detail::PackOrScalar<T>;
+		static constexpr std::size_t REGISTERS = W / P::WIDTH;
+
+		static_assert(std::is_floating_point<T>::value, "A Packet holds float or double lanes");
+		static_assert(W > 0 && W <= 16 && W % P::WIDTH == 0, "A Packet fills whole SIMD registers, with at most 16 lanes");
+
+	public:
+		static constexpr std::size_t WIDTH = W;
+
+		/// <summary>
+		/// Creates a Packet where every lane is 0
+		/// </summary>
+		Packet() : Packet(T(0)) {}
+
+		/// <summary>
+		/// Creates a Packet where every lane is value
+		/// </summary>
+		explicit Packet(const T value)
+		{
+			for (std::size_t i = 0; i < REGISTERS; ++i)
+			{
+				m_lanes[i] = P::set1(value);
+			}
+		}
+
+		/// <summary>
+		/// Loads W contiguous numbers
+		/// </summary>
+		static Packet load(const T* p)
+		{
+			Packet result;
+
+			for (std::size_t i = 0; i < REGISTERS; ++i)
+			{
+				result.m_lanes[i] = P::load(p + i * P::WIDTH);
+			}
+
+			return result;
+		}
+
+		/// <summary>
+		/// Stores the W lanes contiguously
+		/// </summary>
+		void store(T* p) const
+		{
+			for (std::size_t i = 0; i < REGISTERS; ++i)
+			{
+				P::store(p + i * P::WIDTH, m_lanes[i]);
+			}
+		}
+
+		T operator[](const std::size_t lane) const
+		{
+			T values[W];
+			store(values);
+			return values[lane];
+		}
+
+		Packet operator+(const Packet& other) const { return zip(*this, other, [](const auto a, const auto b) { return P::add(a, b); }); }
+		Packet operator-(const Packet& other) const { return zip(*this, other, [](const auto a, const auto b) { return P::sub(a, b); }); }
+		Packet operator*(const Packet& other) const { return zip(*this, other, [](const auto a, const auto b) { return P::mul(a, b); }); }
+		Packet operator/(const Packet& other) const { return zip(*this, other, [](const auto a, const auto b) { return P::div(a, b); }); }
+		Packet operator*(const T scalar) const { return *this * Packet(scalar); }
+		Packet operator/(const T scalar) const { return *this / Packet(scalar); }
+		Packet operator-() const { return Packet() - *this; }
+
+		Packet& operator+=(const Packet& other) { return *this = *this + other; }
+		Packet& operator-=(const Packet& other) { return *this = *this - other; }
+		Packet& operator*=(const Packet& other) { return *this = *this * other; }
+		Packet& operator/=(const Packet& other) { return *this = *this / other; }
+
+		PacketMask<T, W> operator<(const Packet& other) const { return compare(*this, other, [](const auto a, const auto b) { return P::less(a, b); }); }
+		PacketMask<T, W> operator<=(const Packet& other) const { return compare(*this, other, [](const auto a, const auto b) { return P::less_equal(a, b); }); }
+		PacketMask<T, W> operator>(const Packet& other) const { return compare(*this, other, [](const auto a, const auto b) { return P::greater(a, b); }); }
+		PacketMask<T, W> operator>=(const Packet& other) const { return compare(*this, other, [](const auto a, const auto b) { return P::greater_equal(a, b); }); }
+
+		/// <summary>
+		/// Compares lanes exactly, without the EPSILON tolerance of Tuple equality
+		/// </summary>
+		PacketMask<T, W> operator==(const Packet& other) const { return compare(*this, other, [](const auto a, const auto b) { return P::equal_to(a, b); }); }
+		PacketMask<T, W> operator!=(const Packet& other) const { return !(*this == other); }
+
+		static Packet min(const Packet& a, const Packet& b) { return zip(a, b, [](const auto l, const auto r) { return P::min(l, r); }); }
+		static Packet max(const Packet& a, const Packet& b) { return zip(a, b, [](const auto l, const auto r) { return P::max(l, r); }); }
+
+		static Packet sqrt(const Packet& a)
+		{
+			Packet result;
+
+			for (std::size_t i = 0; i < REGISTERS; ++i)
+			{
+				result.m_lanes[i] = P::sqrt(a.m_lanes[i]);
+			}
+
+			return result;
+		}
+
+		/// <summary>
+		/// Takes each lane from a where mask is set, else from b
+		/// </summary>
+		static Packet select(const PacketMask<T, W>& mask, const Packet& a, const Packet& b)
+		{
+			Packet result;
+
+			for (std::size_t i = 0; i < REGISTERS; ++i)
+			{
+				result.m_lanes[i] = P::select(mask.m_mask[i], a.m_lanes[i], b.m_lanes[i]);
+			}
+
+			return result;
+		}
+	private:
+		typename P::Register m_lanes[REGISTERS];
+
+		template<typename OP>
+		static Packet zip(const Packet& a, const Packet& b, const OP op)
+		{
+			Packet result;
+
+			for (std::size_t i = 0; i < REGISTERS; ++i)
+			{
+				result.m_lanes[i] = op(a.m_lanes[i], b.m_lanes[i]);
+			}
+
+			return result;
+		}
+
+		template<typename OP>
+		static PacketMask<T, W> compare(const Packet& a, const Packet& b, const OP op)
+		{
+			PacketMask<T, W> result;
+
+			for (std::size_t i = 0; i < REGISTERS; ++i)
+			{
+				result.m_mask[i] = op(a.m_lanes[i], b.m_lanes[i]);
+			}
+
+			return result;
+		}
+	};
+
+	/// <summary>
+	/// W 3D vectors or points worked on together: the x, y and z components of each are Packets, one lane per vector.
+	/// Evaluating an expression on a Vec3Packet evaluates it on all W vectors at once, for packets of rays or vertices.
+	/// Has the operations of Vector, with scalar results such as dot returned as Packets.
+	/// </summary>
+	template<typename T, std::size_t W>
+	class Vec3Packet
+	{
+	public:
+		using Lanes = Packet<T, W>;
+
+		static constexpr std::size_t WIDTH = W;
+
+		/// <summary>
+		/// Creates a Vec3Packet where every vector is 0, 0, 0
+		/// </summary>
+		Vec3Packet() = default;
+
+		Vec3Packet(const Lanes& x, const Lanes& y, const Lanes& z) : m_x(x), m_y(y), m_z(z) {}
+
+		/// <summary>
+		/// Creates a Vec3Packet where every vector is value
+		/// </summary>
+		explicit Vec3Packet(const Vec<T, 3>& value) : m_x(value.x()), m_y(value.y()), m_z(value.z()) {}
+
+		/// <summary>
+		/// Creates a Vec3Packet where every vector is the x, y and z components of value
+		/// </summary>
+		explicit Vec3Packet(const Tuple4<double>& value)
+			: m_x(static_cast<T>(value.x())), m_y(static_cast<T>(value.y())), m_z(static_cast<T>(value.z())) {}
+
+		const Lanes& x() const { return m_x; }
+		const Lanes& y() const { return m_y; }
+		const Lanes& z() const { return m_z; }
+
+		/// <summary>
+		/// Returns the vector in one lane
+		/// </summary>
+		Vector3<T> operator[](const std::size_t lane) const
+		{
+			return Vector3<T>(m_x[lane], m_y[lane], m_z[lane]);
+		}
+
+		/// <summary>
+		/// Loads W vectors stored as separate x, y and z arrays, such as those of a PointArray or VectorArray
+		/// </summary>
+		static Vec3Packet load(const T* x, const T* y, const T* z)
+		{
+			return Vec3Packet(Lanes::load(x), Lanes::load(y), Lanes::load(z));
+		}
+
+		void store(T* x, T* y, T* z) const
+		{
+			m_x.store(x);
+			m_y.store(y);
+			m_z.store(z);
+		}
+
+		/// <summary>
+		/// Loads the x, y and z components of an array of Points, Vectors, Point3s or Vector3s
+		/// </summary>
+		/// <param name="items">The items to load</param>
+		/// <param name="count">The amount of items to load, at most W. The remaining lanes are 0.</param>
+		template<class ITEM>
+		static Vec3Packet load(const ITEM* items, const std::size_t count = W)
+		{
+			T x[W] = {}, y[W] = {}, z[W] = {};
+
+			for (std::size_t i = 0; i < count && i < W; ++i)
+			{
+				x[i] = static_cast<T>(items[i].x());
+				y[i] = static_cast<T>(items[i].y());
+				z[i] = static_cast<T>(items[i].z());
+			}
+
+			return load(x, y, z);
+		}
+
+		/// <summary>
+		/// Stores the lanes to an array of Points, Vectors, Point3s or Vector3s. Points get w 1 and Vectors w 0, as their constructors give them.
+		/// </summary>
+		/// <param name="items">Receives the items</param>
+		/// <param name="count">The amount of lanes to store, at most W</param>
+		template<class ITEM>
+		void store(ITEM* items, const std::size_t count = W) const
+		{
+			T x[W], y[W], z[W];
+			store(x, y, z);
+
+			for (std::size_t i = 0; i < count && i < W; ++i)
+			{
+				items[i] = ITEM(x[i], y[i], z[i]);
+			}
+		}
+
+		Vec3Packet operator+(const Vec3Packet& other) const { return Vec3Packet(m_x + other.m_x, m_y + other.m_y, m_z + other.m_z); }
+		Vec3Packet operator-(const Vec3Packet& other) const { return Vec3Packet(m_x - other.m_x, m_y - other.m_y, m_z - other.m_z); }
+		Vec3Packet operator-() const { return Vec3Packet(-m_x, -m_y, -m_z); }
+		Vec3Packet operator*(const Lanes& scalars) const { return Vec3Packet(m_x * scalars, m_y * scalars, m_z * scalars); }
+		Vec3Packet operator/(const Lanes& scalars) const { return Vec3Packet(m_x / scalars, m_y / scalars, m_z / scalars); }
+		Vec3Packet operator*(const T scalar) const { return *this * Lanes(scalar); }
+		Vec3Packet operator/(const T scalar) const { return *this / Lanes(scalar); }
+
+		Vec3Packet& operator+=(const Vec3Packet& other) { return *this = *this + other; }
+		Vec3Packet& operator-=(const Vec3Packet& other) { return *this = *this - other; }
+		Vec3Packet& operator*=(const Lanes& scalars) { return *this = *this * scalars; }
+		Vec3Packet& operator/=(const Lanes& scalars) { return *this = *this / scalars; }
+		Vec3Packet& operator*=(const T scalar) { return *this = *this * scalar; }
+		Vec3Packet& operator/=(const T scalar) { return *this = *this / scalar; }
+
+		/// <summary>
+		/// Performs a cross product operation on each pair of vectors
+		/// </summary>
+		static Vec3Packet cross(const Vec3Packet& a, const Vec3Packet& b)
+		{
+			return Vec3Packet(
+				a.m_y * b.m_z - a.m_z * b.m_y,
+				a.m_z * b.m_x - a.m_x * b.m_z,
+				a.m_x * b.m_y - a.m_y * b.m_x
+			);
+		}
+
+		/// <summary>
+		/// Performs a dot product operation on each pair of vectors
+		/// </summary>
+		static Lanes dot(const Vec3Packet& a, const Vec3Packet& b)
+		{
+			return a.m_x * b.m_x + a.m_y * b.m_y + a.m_z * b.m_z;
+		}
+
+		/// <summary>
+		/// Returns the angle between each pair of vectors in degrees, like Vector::angle.
+		/// The arc tangent has no SIMD instruction, so it runs one lane at a time.
+		/// </summary>
+		static Lanes angle(const Vec3Packet& a, const Vec3Packet& b)
+		{
+			return degrees_atan2(cross(b, a).magnitude(), dot(a, b));
+		}
+
+		/// <summary>
+		/// Returns the signed angle between each pair of vectors in degrees around an axis, like Vector::signed_angle
+		/// </summary>
+		static Lanes signed_angle(const Vec3Packet& a, const Vec3Packet& b, const Vec3Packet& axis)
+		{
+			return degrees_atan2(dot(cross(a, b), axis), dot(a, b));
+		}
+
+		/// <summary>
+		/// Reflects each vector off the surface with the normal in the same lane
+		/// </summary>
+		static Vec3Packet reflect(const Vec3Packet& vector, const Vec3Packet& normal)
+		{
+			return vector - normal * (dot(vector, normal) * T(2));
+		}
+
+		Lanes magnitude() const
+		{
+			return Lanes::sqrt(dot(*this, *this));
+		}
+
+		Vec3Packet normalized() const
+		{
+			return *this / magnitude();
+		}
+
+		/// <summary>
+		/// Takes each vector from a where mask is set, else from b
+		/// </summary>
+		static Vec3Packet select(const PacketMask<T, W>& mask, const Vec3Packet& a, const Vec3Packet& b)
+		{
+			return Vec3Packet(Lanes::select(mask, a.m_x, b.m_x), Lanes::select(mask, a.m_y, b.m_y), Lanes::select(mask, a.m_z, b.m_z));
+		}
+
+		/// <summary>
+		/// Transforms each lane as a point by an affine 4x4 Matrix, like Matrix::transform_point
+		/// </summary>
+		template<Layout LAYOUT>
+		Vec3Packet transform_point(const Matrix<T, 4, 4, LAYOUT>& m) const
+		{
+			return transform_vector(m) + Vec3Packet(Lanes(m(0, 3)), Lanes(m(1, 3)), Lanes(m(2, 3)));
+		}
+
+		/// <summary>
+		/// Transforms each lane as a vector by an affine 4x4 Matrix, like Matrix::transform_vector. Vectors are not translated.
+		/// </summary>
+		template<Layout LAYOUT>
+		Vec3Packet transform_vector(const Matrix<T, 4, 4, LAYOUT>& m) const
+		{
+			return Vec3Packet(
+				m_x * m(0, 0) + m_y * m(0, 1) + m_z * m(0, 2),
+				m_x * m(1, 0) + m_y * m(1, 1) + m_z * m(1, 2),
+				m_x * m(2, 0) + m_y * m(2, 1) + m_z * m(2, 2)
+			);
+		}
+
+		/// <summary>
+		/// Rotates each lane about the origin by the rotation matrix of a Quaternion, as Affine3 does
+		/// </summary>
+		Vec3Packet rotated(const Quaternion& rotation) const
+		{
+			return transform_vector(Matrix<T, 4, 4>(rotation.matrix()));
+		}
+	private:
+		Lanes m_x;
+		Lanes m_y;
+		Lanes m_z;
+
+		static Lanes degrees_atan2(const Lanes& y, const Lanes& x)
+		{
+			T ys[W], xs[W], result[W];
+			y.store(ys);
+			x.store(xs);
+
+			for (std::size_t i = 0; i < W; ++i)
+			{
+				result[i] = static_cast<T>(Trig::radians_to_degrees(std::atan2(ys[i], xs[i])));
+			}
+
+			return Lanes::load(result);
+		}
+	};
+
+	/// <summary>
+	/// 8 float vectors, the lanes of one AVX register per component
+	/// </summary>
+	using Vec3x8f = Vec3Packet<float, 8>;
+
+	/// <summary>
+	/// 4 double vectors, the lanes of one AVX register per component
+	/// </summary>
+	using Vec3x4d = Vec3Packet<double, 4>;
+}
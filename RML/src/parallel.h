@@ -0,0 +1,57 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace RML::detail
+{
+	/// <summary>
+	/// The smallest amount of items worth handing to a thread of its own
+	/// </summary>
+	constexpr std::size_t PARALLEL_MIN_ITEMS = 16384;
+
+	/// <summary>
+	/// Splits [0, count) into contiguous ranges and calls fn(begin, end) for each range on its own thread.
+	/// The calling thread handles the first range. Small inputs are not split.
+	/// </summary>
+	/// <param name="count">The amount of items</param>
+	/// <param name="threads">The most threads to use. 0 uses one thread per hardware thread.</param>
+	/// <param name="fn">Called with the begin and end index of each range</param>
+	/// <param name="minItems">The fewest items worth handing to a thread of its own</param>
+	template<class F>
+	void parallel_for(const std::size_t count, unsigned int threads, F&& fn, const std::size_t minItems = PARALLEL_MIN_ITEMS)
+	{
+		if (threads == 0)
+		{
+			threads = std::max(1u, std::thread::hardware_concurrency());
+		}
+
+		const std::size_t maxThreads = std::max<std::size_t>(1, count / std::max<std::size_t>(1, minItems));
+		threads = static_cast<unsigned int>(std::min<std::size_t>(threads, maxThreads));
+
+		if (threads <= 1)
+		{
+			fn(std::size_t(0), count);
+			return;
+		}
+
+		const std::size_t chunk = (count + threads - 1) / threads;
+
+		std::vector<std::thread> workers;
+		workers.reserve(threads - 1);
+
+		for (std::size_t begin = chunk; begin < count; begin += chunk)
+		{
+			workers.emplace_back(fn, begin, std::min(begin + chunk, count));
+		}
+
+		fn(std::size_t(0), std::min(chunk, count));
+
+		for (auto& worker : workers)
+		{
+			worker.join();
+		}
+	}
+}
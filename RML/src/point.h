@@ -1,5 +1,6 @@
 #pragma once
 
+#include "config.h"
 #include "vector.h"
 #include "tuple4.h"
 
@@ -14,14 +15,14 @@ namespace RML
 		/// <summary>
 		/// Constructs a Point at position 0, 0, 0
 		/// </summary>
-		Point();
+		constexpr Point() : Tuple4<double>(0, 0, 0, 1) {}
 
 		/// <summary>
 		/// Constructs a Point from a tuple, by copying x, y and z components.
 		/// W component is set to 1.
 		/// </summary>
 		/// <param name="tuple">The tuple to convert to a Point</param>
-		Point(const Tuple4 tuple);
+		constexpr Point(const Tuple4<double> tuple) : Tuple4<double>(tuple.x(), tuple.y(), tuple.z(), 1) {}
 
 		/// <summary>
 		/// Constructs a Point with x, y and z components
@@ -29,14 +30,32 @@ namespace RML
 		/// <param name="x">X component</param>
 		/// <param name="y">Y component</param>
 		/// <param name="z">Z component</param>
-		Point(const double x, const double y, const double z);
+		constexpr Point(const double x, const double y, const double z) : Tuple4<double>(x, y, z, 1) {}
 
-		Vector operator-(const Point& other) const;
-		Point operator-(const Vector& other) const;
-		Tuple4<double> operator-() const;
+		constexpr Vector operator-(const Point& other) const
+		{
+			return Vector(Tuple4<double>::operator-(other));
+		}
 
-		operator Tuple3<double>() const;
+		constexpr Point operator-(const Vector& other) const
+		{
+			return Point(Tuple4<double>::operator-(other));
+		}
+
+		constexpr Tuple4<double> operator-() const
+		{
+			return Tuple4<double>::operator-();
+		}
+
+		constexpr operator Tuple3<double>() const
+		{
+			return RML::Tuple3<double>(x(), y(), z());
+		}
 	};
 
-	std::ostream& operator<<(std::ostream& os, const Point& p);
+	RML_INLINE std::ostream& operator<<(std::ostream& os, const Point& p);
 }
+
+#if defined(RML_HEADER_ONLY)
+#include "point.inl"
+#endif
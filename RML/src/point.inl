@@ -0,0 +1,12 @@
+#pragma once
+
+#include "point.h"
+
+namespace RML
+{
+	RML_INLINE std::ostream& operator<<(std::ostream& os, const Point& p)
+	{
+		os << p.x() << ", " << p.y() << ", " << p.z() << ", " << p.w();
+		return os;
+	};
+}
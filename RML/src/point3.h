@@ -0,0 +1,80 @@
+#pragma once
+
+#include "vec.h"
+#include "point.h"
+#include "vector3.h"
+
+namespace RML
+{
+	/// <summary>
+	/// A Point in Euclidean Space stored as its x, y and z components only, 12 bytes as float and 24 as double.
+	/// Unlike Point it has no w component: being a point is part of its type, so Transforms and Affine3s always translate it.
+	/// Subtracting two Point3s gives the Vector3 between them, and only a Vector3 can be added to a Point3.
+	/// </summary>
+	template<typename T>
+	class Point3 : public Vec<T, 3> {
+	public:
+		/// <summary>
+		/// Constructs a Point3 at position 0, 0, 0
+		/// </summary>
+		constexpr Point3() : Vec<T, 3>() {}
+
+		/// <summary>
+		/// Constructs a Point3 with x, y and z components
+		/// </summary>
+		/// <param name="x">X component</param>
+		/// <param name="y">Y component</param>
+		/// <param name="z">Z component</param>
+		constexpr Point3(const T x, const T y, const T z) : Vec<T, 3>(x, y, z) {}
+
+		/// <summary>
+		/// Constructs a Point3 from a tuple
+		/// </summary>
+		/// <param name="tuple">The tuple to convert to a Point3</param>
+		explicit constexpr Point3(const Tuple3<T>& tuple) : Vec<T, 3>(tuple) {}
+
+		/// <summary>
+		/// Constructs a Point3 from a Point, by copying x, y and z components
+		/// </summary>
+		/// <param name="point">The Point to convert to a Point3</param>
+		explicit constexpr Point3(const Point& point) : Vec<T, 3>(static_cast<T>(point.x()), static_cast<T>(point.y()), static_cast<T>(point.z())) {}
+
+		/// <summary>
+		/// Converts to a Point, with W component 1
+		/// </summary>
+		explicit constexpr operator Point() const
+		{
+			return Point(this->x(), this->y(), this->z());
+		}
+
+		/// <summary>
+		/// Returns the Vector3 from other to this Point3
+		/// </summary>
+		constexpr Vector3<T> operator-(const Point3& other) const
+		{
+			return Vector3<T>(Vec<T, 3>::operator-(other));
+		}
+
+		constexpr Point3 operator+(const Vector3<T>& offset) const
+		{
+			return Point3(Vec<T, 3>::operator+(offset));
+		}
+
+		constexpr Point3& operator+=(const Vector3<T>& offset)
+		{
+			*this = *this + offset;
+			return *this;
+		}
+
+		constexpr Point3 operator-(const Vector3<T>& offset) const
+		{
+			return Point3(Vec<T, 3>::operator-(offset));
+		}
+
+		constexpr Point3& operator-=(const Vector3<T>& offset)
+		{
+			*this = *this - offset;
+			return *this;
+		}
+	};
+}
@@ -0,0 +1,682 @@
+#pragma once
+
+#include <cstddef>
+#include <initializer_list>
+#include <iostream>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+#include "point.h"
+#include "vector.h"
+#include "point3.h"
+#include "vector3.h"
+#include "quaternion.h"
+#include "transform.h"
+#include "affine.h"
+#include "soa.h"
+#include "storage.h"
+
+namespace RML
+{
+	namespace detail
+	{
+		/// <summary>
+		/// Refers to one item of an XyzArray, whose x, y and z components live in three separate arrays.
+		/// Reads as VALUE or as COMPATIBLE, the 4 component type of the same kind, and assigning either writes the item back.
+		/// T is const for items of a const array.
+		/// </summary>
+		template<typename T, class VALUE, class COMPATIBLE>
+		class XyzReference
+		{
+		public:
+			XyzReference(T* x, T* y, T* z) : m_x(x), m_y(y), m_z(z) {}
+
+			XyzReference(const XyzReference& other) = default;
+
+			std::remove_const_t<T> x() const { return *m_x; }
+			std::remove_const_t<T> y() const { return *m_y; }
+			std::remove_const_t<T> z() const { return *m_z; }
+
+			operator VALUE() const
+			{
+				return VALUE(*m_x, *m_y, *m_z);
+			}
+
+			operator COMPATIBLE() const
+			{
+				return COMPATIBLE(*m_x, *m_y, *m_z);
+			}
+
+			/// <summary>
+			/// Writes the components of the referred item, rather than referring to the other item
+			/// </summary>
+			XyzReference& operator=(const XyzReference& other)
+			{
+				return *this = VALUE(other);
+			}
+
+			XyzReference& operator=(const VALUE& value)
+			{
+				*m_x = value.x();
+				*m_y = value.y();
+				*m_z = value.z();
+				return *this;
+			}
+
+			XyzReference& operator=(const COMPATIBLE& value)
+			{
+				*m_x = static_cast<T>(value.x());
+				*m_y = static_cast<T>(value.y());
+				*m_z = static_cast<T>(value.z());
+				return *this;
+			}
+
+			friend bool operator==(const XyzReference& a, const VALUE& b)
+			{
+				return VALUE(a) == b;
+			}
+
+			friend bool operator==(const VALUE& a, const XyzReference& b)
+			{
+				return a == VALUE(b);
+			}
+
+			friend bool operator!=(const XyzReference& a, const VALUE& b)
+			{
+				return !(a == b);
+			}
+
+			friend bool operator!=(const VALUE& a, const XyzReference& b)
+			{
+				return !(a == b);
+			}
+
+			friend std::ostream& operator<<(std::ostream& os, const XyzReference& reference)
+			{
+				return os << VALUE(reference);
+			}
+		private:
+			T* m_x;
+			T* m_y;
+			T* m_z;
+		};
+
+		/// <summary>
+		/// Walks the items of an XyzArray, giving an XyzReference to each
+		/// </summary>
+		template<typename T, class VALUE, class COMPATIBLE>
+		class XyzIterator
+		{
+		public:
+			using iterator_category = std::random_access_iterator_tag;
+			using value_type = VALUE;
+			using difference_type = std::ptrdiff_t;
+			using reference = XyzReference<T, VALUE, COMPATIBLE>;
+			using pointer = void;
+
+			XyzIterator() : m_x(nullptr), m_y(nullptr), m_z(nullptr), m_index(0) {}
+
+			XyzIterator(T* x, T* y, T* z, const std::ptrdiff_t index) : m_x(x), m_y(y), m_z(z), m_index(index) {}
+
+			/// <summary>
+			/// Converts an iterator over a mutable array to one over a const array
+			/// </summary>
+			template<typename U, typename = std::enable_if_t<std::is_same<const U, T>::value && !std::is_same<U, T>::value>>
+			XyzIterator(const XyzIterator<U, VALUE, COMPATIBLE>& other) : XyzIterator(other.m_x, other.m_y, other.m_z, other.m_index) {}
+
+			reference operator*() const
+			{
+				return reference(m_x + m_index, m_y + m_index, m_z + m_index);
+			}
+
+			reference operator[](const difference_type offset) const
+			{
+				return *(*this + offset);
+			}
+
+			XyzIterator& operator++() { ++m_index; return *this; }
+			XyzIterator& operator--() { --m_index; return *this; }
+			XyzIterator operator++(int) { XyzIterator copy = *this; ++m_index; return copy; }
+			XyzIterator operator--(int) { XyzIterator copy = *this; --m_index; return copy; }
+
+			XyzIterator& operator+=(const difference_type offset) { m_index += offset; return *this; }
+			XyzIterator& operator-=(const difference_type offset) { m_index -= offset; return *this; }
+
+			XyzIterator operator+(const difference_type offset) const { return XyzIterator(m_x, m_y, m_z, m_index + offset); }
+			XyzIterator operator-(const difference_type offset) const { return XyzIterator(m_x, m_y, m_z, m_index - offset); }
+			friend XyzIterator operator+(const difference_type offset, const XyzIterator& it) { return it + offset; }
+
+			difference_type operator-(const XyzIterator& other) const { return m_index - other.m_index; }
+
+			bool operator==(const XyzIterator& other) const { return m_x == other.m_x && m_index == other.m_index; }
+			bool operator!=(const XyzIterator& other) const { return !(*this == other); }
+			bool operator<(const XyzIterator& other) const { return m_index < other.m_index; }
+			bool operator>(const XyzIterator& other) const { return m_index > other.m_index; }
+			bool operator<=(const XyzIterator& other) const { return m_index <= other.m_index; }
+			bool operator>=(const XyzIterator& other) const { return m_index >= other.m_index; }
+		private:
+			template<typename, class, class>
+			friend class XyzIterator;
+
+			T* m_x;
+			T* m_y;
+			T* m_z;
+			std::ptrdiff_t m_index;
+		};
+
+		/// <summary>
+		/// The storage shared by PointArray and VectorArray: the x, y and z components of every item in three separate arrays,
+		/// each aligned to a cache line, so the bulk operations load whole SIMD registers of one component at a time.
+		/// </summary>
+		template<typename T, class VALUE, class COMPATIBLE>
+		class XyzArray
+		{
+			static_assert(std::is_floating_point<T>::value, "The components of an XyzArray are float or double");
+
+		public:
+			using value_type = VALUE;
+			using reference = XyzReference<T, VALUE, COMPATIBLE>;
+			using iterator = XyzIterator<T, VALUE, COMPATIBLE>;
+			using const_iterator = XyzIterator<const T, VALUE, COMPATIBLE>;
+
+			/// <summary>
+			/// Creates an empty array
+			/// </summary>
+			XyzArray() = default;
+
+			/// <summary>
+			/// Creates an array of count items with every component 0
+			/// </summary>
+			explicit XyzArray(const std::size_t count) : m_x(count), m_y(count), m_z(count) {}
+
+			XyzArray(const std::initializer_list<VALUE> items)
+			{
+				reserve(items.size());
+
+				for (const VALUE& item : items)
+				{
+					push_back(item);
+				}
+			}
+
+			/// <summary>
+			/// Copies the x, y and z components of an array of COMPATIBLE items
+			/// </summary>
+			XyzArray(const COMPATIBLE* items, const std::size_t count)
+			{
+				reserve(count);
+
+				for (std::size_t i = 0; i < count; ++i)
+				{
+					push_back(items[i]);
+				}
+			}
+
+			std::size_t size() const { return m_x.size(); }
+			bool empty() const { return m_x.empty(); }
+
+			void reserve(const std::size_t count)
+			{
+				m_x.reserve(count);
+				m_y.reserve(count);
+				m_z.reserve(count);
+			}
+
+			/// <summary>
+			/// Changes the amount of items. New items have every component 0.
+			/// </summary>
+			void resize(const std::size_t count)
+			{
+				m_x.resize(count);
+				m_y.resize(count);
+				m_z.resize(count);
+			}
+
+			void clear()
+			{
+				m_x.clear();
+				m_y.clear();
+				m_z.clear();
+			}
+
+			void push_back(const VALUE& item)
+			{
+				m_x.push_back(item.x());
+				m_y.push_back(item.y());
+				m_z.push_back(item.z());
+			}
+
+			void push_back(const COMPATIBLE& item)
+			{
+				push_back(VALUE(item));
+			}
+
+			VALUE operator[](const std::size_t i) const
+			{
+				return VALUE(m_x[i], m_y[i], m_z[i]);
+			}
+
+			reference operator[](const std::size_t i)
+			{
+				return reference(&m_x[i], &m_y[i], &m_z[i]);
+			}
+
+			iterator begin() { return iterator(m_x.data(), m_y.data(), m_z.data(), 0); }
+			iterator end() { return begin() + size(); }
+			const_iterator begin() const { return const_iterator(m_x.data(), m_y.data(), m_z.data(), 0); }
+			const_iterator end() const { return begin() + size(); }
+			const_iterator cbegin() const { return begin(); }
+			const_iterator cend() const { return end(); }
+
+			/// <summary>
+			/// The x components of every item, contiguous and aligned to a cache line
+			/// </summary>
+			T* x() { return m_x.data(); }
+			const T* x() const { return m_x.data(); }
+
+			/// <summary>
+			/// The y components of every item, contiguous and aligned to a cache line
+			/// </summary>
+			T* y() { return m_y.data(); }
+			const T* y() const { return m_y.data(); }
+
+			/// <summary>
+			/// The z components of every item, contiguous and aligned to a cache line
+			/// </summary>
+			T* z() { return m_z.data(); }
+			const T* z() const { return m_z.data(); }
+
+			bool operator==(const XyzArray& other) const
+			{
+				if (size() != other.size())
+				{
+					return false;
+				}
+
+				for (std::size_t i = 0; i < size(); ++i)
+				{
+					if ((*this)[i] != other[i])
+					{
+						return false;
+					}
+				}
+
+				return true;
+			}
+
+			bool operator!=(const XyzArray& other) const
+			{
+				return !(*this == other);
+			}
+		protected:
+			/// <summary>
+			/// Checks that an elementwise operation has an item of other for every item of this array
+			/// </summary>
+			bool same_size(const std::size_t otherSize) const
+			{
+				if (size() != otherSize)
+				{
+					std::cerr << "Arrays have different sizes: " << size() << " and " << otherSize << std::endl;
+					return false;
+				}
+
+				return true;
+			}
+
+			/// <summary>
+			/// Checks that a reduction has at least one item to work on
+			/// </summary>
+			bool not_empty() const
+			{
+				if (empty())
+				{
+					std::cerr << "Array is empty" << std::endl;
+					return false;
+				}
+
+				return true;
+			}
+
+			std::vector<T, AlignedAllocator<T>> m_x;
+			std::vector<T, AlignedAllocator<T>> m_y;
+			std::vector<T, AlignedAllocator<T>> m_z;
+		};
+	}
+
+	/// <summary>
+	/// Many Vector3s stored as separate x, y and z arrays, so bulk operations work through several vectors per SIMD instruction
+	/// instead of one Vector3 at a time. Items read and write as Vector3 or as Vector.
+	/// Operations on two arrays report a size mismatch and leave the result unchanged.
+	/// </summary>
+	template<typename T>
+	class VectorArray : public detail::XyzArray<T, Vector3<T>, Vector>
+	{
+		using Base = detail::XyzArray<T, Vector3<T>, Vector>;
+
+	public:
+		using Base::Base;
+
+		VectorArray& operator+=(const VectorArray& other)
+		{
+			if (this->same_size(other.size()))
+			{
+				detail::soa_add(this->x(), other.x(), this->x(), this->size());
+				detail::soa_add(this->y(), other.y(), this->y(), this->size());
+				detail::soa_add(this->z(), other.z(), this->z(), this->size());
+			}
+
+			return *this;
+		}
+
+		VectorArray operator+(const VectorArray& other) const
+		{
+			VectorArray result(*this);
+			return result += other;
+		}
+
+		VectorArray& operator-=(const VectorArray& other)
+		{
+			if (this->same_size(other.size()))
+			{
+				detail::soa_sub(this->x(), other.x(), this->x(), this->size());
+				detail::soa_sub(this->y(), other.y(), this->y(), this->size());
+				detail::soa_sub(this->z(), other.z(), this->z(), this->size());
+			}
+
+			return *this;
+		}
+
+		VectorArray operator-(const VectorArray& other) const
+		{
+			VectorArray result(*this);
+			return result -= other;
+		}
+
+		VectorArray& operator*=(const T scalar)
+		{
+			detail::soa_scale(this->x(), scalar, this->x(), this->size());
+			detail::soa_scale(this->y(), scalar, this->y(), this->size());
+			detail::soa_scale(this->z(), scalar, this->z(), this->size());
+			return *this;
+		}
+
+		VectorArray operator*(const T scalar) const
+		{
+			VectorArray result(*this);
+			return result *= scalar;
+		}
+
+		/// <summary>
+		/// Writes the dot product of each pair of vectors of a and b to result
+		/// </summary>
+		/// <param name="result">Receives one dot product per vector</param>
+		static void dot(const VectorArray& a, const VectorArray& b, T* result)
+		{
+			if (a.same_size(b.size()))
+			{
+				detail::soa_dot(a.x(), a.y(), a.z(), b.x(), b.y(), b.z(), result, a.size());
+			}
+		}
+
+		/// <summary>
+		/// Returns the cross product of each pair of vectors of a and b
+		/// </summary>
+		static VectorArray cross(const VectorArray& a, const VectorArray& b)
+		{
+			if (!a.same_size(b.size()))
+			{
+				return VectorArray();
+			}
+
+			VectorArray result(a.size());
+			detail::soa_cross(a.x(), a.y(), a.z(), b.x(), b.y(), b.z(), result.x(), result.y(), result.z(), a.size());
+
+			return result;
+		}
+
+		/// <summary>
+		/// Writes the magnitude of each vector to result
+		/// </summary>
+		/// <param name="result">Receives one magnitude per vector</param>
+		void magnitude(T* result) const
+		{
+			detail::soa_magnitude(this->x(), this->y(), this->z(), result, this->size());
+		}
+
+		/// <summary>
+		/// Divides every vector by its magnitude
+		/// </summary>
+		void normalize()
+		{
+			detail::soa_normalize(this->x(), this->y(), this->z(), this->x(), this->y(), this->z(), this->size());
+		}
+
+		VectorArray normalized() const
+		{
+			VectorArray result(*this);
+			result.normalize();
+			return result;
+		}
+
+		/// <summary>
+		/// Returns the sum of every vector, 0 when the array is empty
+		/// </summary>
+		Vector3<T> sum() const
+		{
+			if (this->empty())
+			{
+				return Vector3<T>();
+			}
+
+			return Vector3<T>(detail::soa_sum(this->x(), this->size()), detail::soa_sum(this->y(), this->size()), detail::soa_sum(this->z(), this->size()));
+		}
+
+		/// <summary>
+		/// Returns the smallest x, y and z components of any vector
+		/// </summary>
+		Vector3<T> min() const
+		{
+			if (!this->not_empty())
+			{
+				return Vector3<T>();
+			}
+
+			return Vector3<T>(detail::soa_min(this->x(), this->size()), detail::soa_min(this->y(), this->size()), detail::soa_min(this->z(), this->size()));
+		}
+
+		/// <summary>
+		/// Returns the largest x, y and z components of any vector
+		/// </summary>
+		Vector3<T> max() const
+		{
+			if (!this->not_empty())
+			{
+				return Vector3<T>();
+			}
+
+			return Vector3<T>(detail::soa_max(this->x(), this->size()), detail::soa_max(this->y(), this->size()), detail::soa_max(this->z(), this->size()));
+		}
+
+		/// <summary>
+		/// Transforms every vector. Vectors are not translated.
+		/// </summary>
+		/// <param name="threads">The most threads to split large arrays across. 0 uses every hardware thread.</param>
+		void apply(const Affine3<T>& affine, const unsigned int threads = 1)
+		{
+			affine.apply_vectors(this->x(), this->y(), this->z(), this->x(), this->y(), this->z(), this->size(), threads);
+		}
+
+		/// <summary>
+		/// Transforms every vector by the top three rows of a Transform. Vectors are not translated.
+		/// </summary>
+		/// <param name="threads">The most threads to split large arrays across. 0 uses every hardware thread.</param>
+		void apply(const Transform& transform, const unsigned int threads = 1)
+		{
+			apply(Affine3<T>(transform), threads);
+		}
+
+		/// <summary>
+		/// Rotates every vector by the rotation matrix of a Quaternion, as Affine3 does
+		/// </summary>
+		/// <param name="threads">The most threads to split large arrays across. 0 uses every hardware thread.</param>
+		void apply(const Quaternion& rotation, const unsigned int threads = 1)
+		{
+			apply(Affine3<T>(rotation), threads);
+		}
+	};
+
+	/// <summary>
+	/// Many Point3s stored as separate x, y and z arrays, so bulk operations work through several points per SIMD instruction
+	/// instead of one Point3 at a time. Items read and write as Point3 or as Point.
+	/// Operations on two arrays report a size mismatch and leave the result unchanged.
+	/// </summary>
+	template<typename T>
+	class PointArray : public detail::XyzArray<T, Point3<T>, Point>
+	{
+		using Base = detail::XyzArray<T, Point3<T>, Point>;
+
+	public:
+		using Base::Base;
+
+		/// <summary>
+		/// Moves each point by the vector of offsets with the same index
+		/// </summary>
+		PointArray& operator+=(const VectorArray<T>& offsets)
+		{
+			if (this->same_size(offsets.size()))
+			{
+				detail::soa_add(this->x(), offsets.x(), this->x(), this->size());
+				detail::soa_add(this->y(), offsets.y(), this->y(), this->size());
+				detail::soa_add(this->z(), offsets.z(), this->z(), this->size());
+			}
+
+			return *this;
+		}
+
+		PointArray& operator-=(const VectorArray<T>& offsets)
+		{
+			if (this->same_size(offsets.size()))
+			{
+				detail::soa_sub(this->x(), offsets.x(), this->x(), this->size());
+				detail::soa_sub(this->y(), offsets.y(), this->y(), this->size());
+				detail::soa_sub(this->z(), offsets.z(), this->z(), this->size());
+			}
+
+			return *this;
+		}
+
+		/// <summary>
+		/// Moves every point by the same offset
+		/// </summary>
+		PointArray& operator+=(const Vector3<T>& offset)
+		{
+			detail::soa_offset(this->x(), offset.x(), this->x(), this->size());
+			detail::soa_offset(this->y(), offset.y(), this->y(), this->size());
+			detail::soa_offset(this->z(), offset.z(), this->z(), this->size());
+			return *this;
+		}
+
+		PointArray& operator-=(const Vector3<T>& offset)
+		{
+			return *this += -offset;
+		}
+
+		PointArray operator+(const VectorArray<T>& offsets) const
+		{
+			PointArray result(*this);
+			return result += offsets;
+		}
+
+		PointArray operator+(const Vector3<T>& offset) const
+		{
+			PointArray result(*this);
+			return result += offset;
+		}
+
+		/// <summary>
+		/// Returns the vectors from each point of other to the point of this array with the same index
+		/// </summary>
+		VectorArray<T> operator-(const PointArray& other) const
+		{
+			if (!this->same_size(other.size()))
+			{
+				return VectorArray<T>();
+			}
+
+			VectorArray<T> result(this->size());
+			detail::soa_sub(this->x(), other.x(), result.x(), this->size());
+			detail::soa_sub(this->y(), other.y(), result.y(), this->size());
+			detail::soa_sub(this->z(), other.z(), result.z(), this->size());
+
+			return result;
+		}
+
+		/// <summary>
+		/// Returns the mean position of every point
+		/// </summary>
+		Point3<T> centroid() const
+		{
+			if (!this->not_empty())
+			{
+				return Point3<T>();
+			}
+
+			const T count = static_cast<T>(this->size());
+
+			return Point3<T>(detail::soa_sum(this->x(), this->size()) / count, detail::soa_sum(this->y(), this->size()) / count, detail::soa_sum(this->z(), this->size()) / count);
+		}
+
+		/// <summary>
+		/// Returns the corner of the axis aligned bounding box of every point with the smallest components
+		/// </summary>
+		Point3<T> min() const
+		{
+			if (!this->not_empty())
+			{
+				return Point3<T>();
+			}
+
+			return Point3<T>(detail::soa_min(this->x(), this->size()), detail::soa_min(this->y(), this->size()), detail::soa_min(this->z(), this->size()));
+		}
+
+		/// <summary>
+		/// Returns the corner of the axis aligned bounding box of every point with the largest components
+		/// </summary>
+		Point3<T> max() const
+		{
+			if (!this->not_empty())
+			{
+				return Point3<T>();
+			}
+
+			return Point3<T>(detail::soa_max(this->x(), this->size()), detail::soa_max(this->y(), this->size()), detail::soa_max(this->z(), this->size()));
+		}
+
+		/// <summary>
+		/// Transforms every point
+		/// </summary>
+		/// <param name="threads">The most threads to split large arrays across. 0 uses every hardware thread.</param>
+		void apply(const Affine3<T>& affine, const unsigned int threads = 1)
+		{
+			affine.apply(this->x(), this->y(), this->z(), this->x(), this->y(), this->z(), this->size(), threads);
+		}
+
+		/// <summary>
+		/// Transforms every point by the top three rows of a Transform
+		/// </summary>
+		/// <param name="threads">The most threads to split large arrays across. 0 uses every hardware thread.</param>
+		void apply(const Transform& transform, const unsigned int threads = 1)
+		{
+			apply(Affine3<T>(transform), threads);
+		}
+
+		/// <summary>
+		/// Rotates every point about the origin by the rotation matrix of a Quaternion, as Affine3 does
+		/// </summary>
+		/// <param name="threads">The most threads to split large arrays across. 0 uses every hardware thread.</param>
+		void apply(const Quaternion& rotation, const unsigned int threads = 1)
+		{
+			apply(Affine3<T>(rotation), threads);
+		}
+	};
+}
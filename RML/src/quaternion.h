@@ -1,4 +1,5 @@
 #pragma once
+#include "config.h"
 #include "matrix.h"
 #include "tuple3.h"
 #include "tuple4.h"
@@ -48,5 +49,9 @@ namespace RML
 		double m_w, m_i, m_j, m_k;
 	};
 
-	std::ostream& operator<<(std::ostream& os, const Quaternion& q);
+	RML_INLINE std::ostream& operator<<(std::ostream& os, const Quaternion& q);
 }
+
+#if defined(RML_HEADER_ONLY)
+#include "quaternion.inl"
+#endif
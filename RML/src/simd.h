@@ -0,0 +1,912 @@
+#pragma once
+
+// SIMD kernels are enabled from the instruction sets the compiler targets.
+// SSE2 is always available on x64. AVX2 needs /arch:AVX2 (MSVC) or -mavx2 (GCC / Clang).
+// Define RML_NO_SIMD to force the scalar kernels.
+#if !defined(RML_NO_SIMD)
+	#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+		#define RML_SSE2 1
+	#endif
+	#if defined(__AVX2__)
+		#define RML_AVX2 1
+	#endif
+#endif
+
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+
+#if defined(RML_SSE2)
+	#include <emmintrin.h>
+#endif
+#if defined(RML_AVX2)
+	#include <immintrin.h>
+#endif
+
+/// <summary>
+/// Kernels for 4x4 row-major matrices stored as 16 contiguous numbers, and affine 3x4 matrices stored as their top 12.
+/// A column-major matrix is the row-major storage of its transpose, so the same kernels serve both layouts,
+/// apart from the multiply4x4_columns_tuple kernels.
+/// Each kernel has a scalar version that is used when SIMD is unavailable.
+/// </summary>
+namespace RML::detail
+{
+	/// <summary>
+	/// Checks if the caller is being evaluated in a constant expression, where SIMD intrinsics cannot be used
+	/// </summary>
+	constexpr bool is_constant_evaluated()
+	{
+#if defined(__GNUC__) || defined(__clang__) || (defined(_MSC_VER) && _MSC_VER >= 1925)
+		return __builtin_is_constant_evaluated();
+#else
+		return false;
+#endif
+	}
+
+	/// <summary>
+	/// Multiplies two 4x4 matrices one element at a time
+	/// </summary>
+	/// <param name="a">The left hand side</param>
+	/// <param name="b">The right hand side</param>
+	/// <param name="result">Receives a * b. Must not alias a or b.</param>
+	template<typename T>
+	constexpr void multiply4x4_scalar(const T* a, const T* b, T* result)
+	{
+		for (int row = 0; row < 4; ++row)
+		{
+			for (int col = 0; col < 4; ++col)
+			{
+				result[row * 4 + col] =
+					  a[row * 4 + 0] * b[0 * 4 + col]
+					+ a[row * 4 + 1] * b[1 * 4 + col]
+					+ a[row * 4 + 2] * b[2 * 4 + col]
+					+ a[row * 4 + 3] * b[3 * 4 + col];
+			}
+		}
+	}
+
+	/// <summary>
+	/// Multiplies a 4x4 matrix with a column of 4 numbers one element at a time
+	/// </summary>
+	/// <param name="m">The matrix</param>
+	/// <param name="v">The column</param>
+	/// <param name="result">Receives m * v. Must not alias v.</param>
+	template<typename T>
+	constexpr void multiply4x4_tuple_scalar(const T* m, const T* v, T* result)
+	{
+		result[0] = m[0] * v[0] + m[1] * v[1] + m[2] * v[2] + m[3] * v[3];
+		result[1] = m[4] * v[0] + m[5] * v[1] + m[6] * v[2] + m[7] * v[3];
+		result[2] = m[8] * v[0] + m[9] * v[1] + m[10] * v[2] + m[11] * v[3];
+		result[3] = m[12] * v[0] + m[13] * v[1] + m[14] * v[2] + m[15] * v[3];
+	}
+
+	/// <summary>
+	/// Multiplies a 4x4 column-major matrix with a column of 4 numbers one element at a time
+	/// </summary>
+	/// <param name="m">The column-major matrix</param>
+	/// <param name="v">The column</param>
+	/// <param name="result">Receives m * v. Must not alias v.</param>
+	template<typename T>
+	constexpr void multiply4x4_columns_tuple_scalar(const T* m, const T* v, T* result)
+	{
+		for (int row = 0; row < 4; ++row)
+		{
+			result[row] = m[row] * v[0] + m[4 + row] * v[1] + m[8 + row] * v[2] + m[12 + row] * v[3];
+		}
+	}
+
+	/// <summary>
+	/// Multiplies two affine 3x4 matrices one element at a time.
+	/// Each is the top three rows of a 4x4 matrix whose bottom row is 0, 0, 0, 1, so the bottom row is never read or written.
+	/// </summary>
+	/// <param name="a">The left hand side</param>
+	/// <param name="b">The right hand side</param>
+	/// <param name="result">Receives a * b. Must not alias a or b.</param>
+	template<typename T>
+	constexpr void multiply3x4_scalar(const T* a, const T* b, T* result)
+	{
+		for (int row = 0; row < 3; ++row)
+		{
+			for (int col = 0; col < 4; ++col)
+			{
+				result[row * 4 + col] =
+					  a[row * 4 + 0] * b[0 * 4 + col]
+					+ a[row * 4 + 1] * b[1 * 4 + col]
+					+ a[row * 4 + 2] * b[2 * 4 + col];
+			}
+
+			result[row * 4 + 3] += a[row * 4 + 3];
+		}
+	}
+
+	template<typename T>
+	inline void multiply4x4(const T* a, const T* b, T* result)
+	{
+		multiply4x4_scalar(a, b, result);
+	}
+
+	template<typename T>
+	inline void multiply4x4_tuple(const T* m, const T* v, T* result)
+	{
+		multiply4x4_tuple_scalar(m, v, result);
+	}
+
+	template<typename T>
+	inline void multiply4x4_columns_tuple(const T* m, const T* v, T* result)
+	{
+		multiply4x4_columns_tuple_scalar(m, v, result);
+	}
+
+	template<typename T>
+	inline void multiply3x4(const T* a, const T* b, T* result)
+	{
+		multiply3x4_scalar(a, b, result);
+	}
+
+#if defined(RML_SSE2)
+	// Each row of the result is a linear combination of the rows of b,
+	// so one SSE register holds a whole row of floats.
+	inline void multiply4x4(const float* a, const float* b, float* result)
+	{
+		const __m128 b0 = _mm_loadu_ps(b + 0);
+		const __m128 b1 = _mm_loadu_ps(b + 4);
+		const __m128 b2 = _mm_loadu_ps(b + 8);
+		const __m128 b3 = _mm_loadu_ps(b + 12);
+
+		for (int row = 0; row < 4; ++row)
+		{
+			const float* r = a + row * 4;
+
+			__m128 value = _mm_mul_ps(_mm_set1_ps(r[0]), b0);
+			value = _mm_add_ps(value, _mm_mul_ps(_mm_set1_ps(r[1]), b1));
+			value = _mm_add_ps(value, _mm_mul_ps(_mm_set1_ps(r[2]), b2));
+			value = _mm_add_ps(value, _mm_mul_ps(_mm_set1_ps(r[3]), b3));
+
+			_mm_storeu_ps(result + row * 4, value);
+		}
+	}
+
+	inline void multiply4x4_tuple(const float* m, const float* v, float* result)
+	{
+		const __m128 column = _mm_loadu_ps(v);
+
+		__m128 r0 = _mm_mul_ps(_mm_loadu_ps(m + 0), column);
+		__m128 r1 = _mm_mul_ps(_mm_loadu_ps(m + 4), column);
+		__m128 r2 = _mm_mul_ps(_mm_loadu_ps(m + 8), column);
+		__m128 r3 = _mm_mul_ps(_mm_loadu_ps(m + 12), column);
+
+		// Lane i of each register now holds one product of row i, so transposing lines up the sums
+		_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+		_mm_storeu_ps(result, _mm_add_ps(_mm_add_ps(r0, r1), _mm_add_ps(r2, r3)));
+	}
+
+	// The result is a linear combination of the columns of m, which are contiguous in a column-major matrix,
+	// so no horizontal sums are needed
+	inline void multiply4x4_columns_tuple(const float* m, const float* v, float* result)
+	{
+		__m128 value = _mm_mul_ps(_mm_loadu_ps(m + 0), _mm_set1_ps(v[0]));
+		value = _mm_add_ps(value, _mm_mul_ps(_mm_loadu_ps(m + 4), _mm_set1_ps(v[1])));
+		value = _mm_add_ps(value, _mm_mul_ps(_mm_loadu_ps(m + 8), _mm_set1_ps(v[2])));
+		value = _mm_add_ps(value, _mm_mul_ps(_mm_loadu_ps(m + 12), _mm_set1_ps(v[3])));
+
+		_mm_storeu_ps(result, value);
+	}
+
+	// Like multiply4x4 with the implied bottom row of b held in a register instead of loaded
+	inline void multiply3x4(const float* a, const float* b, float* result)
+	{
+		const __m128 b0 = _mm_loadu_ps(b + 0);
+		const __m128 b1 = _mm_loadu_ps(b + 4);
+		const __m128 b2 = _mm_loadu_ps(b + 8);
+		const __m128 b3 = _mm_setr_ps(0, 0, 0, 1);
+
+		for (int row = 0; row < 3; ++row)
+		{
+			const float* r = a + row * 4;
+
+			__m128 value = _mm_mul_ps(_mm_set1_ps(r[3]), b3);
+			value = _mm_add_ps(value, _mm_mul_ps(_mm_set1_ps(r[0]), b0));
+			value = _mm_add_ps(value, _mm_mul_ps(_mm_set1_ps(r[1]), b1));
+			value = _mm_add_ps(value, _mm_mul_ps(_mm_set1_ps(r[2]), b2));
+
+			_mm_storeu_ps(result + row * 4, value);
+		}
+	}
+#endif
+
+#if defined(RML_AVX2)
+	inline void multiply4x4(const double* a, const double* b, double* result)
+	{
+		const __m256d b0 = _mm256_loadu_pd(b + 0);
+		const __m256d b1 = _mm256_loadu_pd(b + 4);
+		const __m256d b2 = _mm256_loadu_pd(b + 8);
+		const __m256d b3 = _mm256_loadu_pd(b + 12);
+
+		for (int row = 0; row < 4; ++row)
+		{
+			const double* r = a + row * 4;
+
+			__m256d value = _mm256_mul_pd(_mm256_broadcast_sd(r + 0), b0);
+			value = _mm256_add_pd(value, _mm256_mul_pd(_mm256_broadcast_sd(r + 1), b1));
+			value = _mm256_add_pd(value, _mm256_mul_pd(_mm256_broadcast_sd(r + 2), b2));
+			value = _mm256_add_pd(value, _mm256_mul_pd(_mm256_broadcast_sd(r + 3), b3));
+
+			_mm256_storeu_pd(result + row * 4, value);
+		}
+	}
+
+	inline void multiply4x4_tuple(const double* m, const double* v, double* result)
+	{
+		const __m256d column = _mm256_loadu_pd(v);
+
+		const __m256d r0 = _mm256_mul_pd(_mm256_loadu_pd(m + 0), column);
+		const __m256d r1 = _mm256_mul_pd(_mm256_loadu_pd(m + 4), column);
+		const __m256d r2 = _mm256_mul_pd(_mm256_loadu_pd(m + 8), column);
+		const __m256d r3 = _mm256_mul_pd(_mm256_loadu_pd(m + 12), column);
+
+		// [r0 01, r1 01, r0 23, r1 23] and [r2 01, r3 01, r2 23, r3 23]
+		const __m256d h01 = _mm256_hadd_pd(r0, r1);
+		const __m256d h23 = _mm256_hadd_pd(r2, r3);
+
+		const __m256d low = _mm256_blend_pd(h01, h23, 0b1100);
+		const __m256d high = _mm256_permute2f128_pd(h01, h23, 0x21);
+
+		_mm256_storeu_pd(result, _mm256_add_pd(low, high));
+	}
+
+	inline void multiply4x4_columns_tuple(const double* m, const double* v, double* result)
+	{
+		__m256d value = _mm256_mul_pd(_mm256_loadu_pd(m + 0), _mm256_broadcast_sd(v + 0));
+		value = _mm256_add_pd(value, _mm256_mul_pd(_mm256_loadu_pd(m + 4), _mm256_broadcast_sd(v + 1)));
+		value = _mm256_add_pd(value, _mm256_mul_pd(_mm256_loadu_pd(m + 8), _mm256_broadcast_sd(v + 2)));
+		value = _mm256_add_pd(value, _mm256_mul_pd(_mm256_loadu_pd(m + 12), _mm256_broadcast_sd(v + 3)));
+
+		_mm256_storeu_pd(result, value);
+	}
+
+	inline void multiply3x4(const double* a, const double* b, double* result)
+	{
+		const __m256d b0 = _mm256_loadu_pd(b + 0);
+		const __m256d b1 = _mm256_loadu_pd(b + 4);
+		const __m256d b2 = _mm256_loadu_pd(b + 8);
+		const __m256d b3 = _mm256_setr_pd(0, 0, 0, 1);
+
+		for (int row = 0; row < 3; ++row)
+		{
+			const double* r = a + row * 4;
+
+			__m256d value = _mm256_mul_pd(_mm256_broadcast_sd(r + 3), b3);
+			value = _mm256_add_pd(value, _mm256_mul_pd(_mm256_broadcast_sd(r + 0), b0));
+			value = _mm256_add_pd(value, _mm256_mul_pd(_mm256_broadcast_sd(r + 1), b1));
+			value = _mm256_add_pd(value, _mm256_mul_pd(_mm256_broadcast_sd(r + 2), b2));
+
+			_mm256_storeu_pd(result + row * 4, value);
+		}
+	}
+#endif
+
+	/// <summary>
+	/// The widest SIMD register available for T, with the handful of operations the batch kernels need.
+	/// WIDTH is 1 when there is no SIMD register for T.
+	/// </summary>
+	template<typename T>
+	struct Pack
+	{
+		static constexpr int WIDTH = 1;
+	};
+
+#if defined(RML_AVX2)
+	template<>
+	struct Pack<double>
+	{
+		using Register = __m256d;
+		static constexpr int WIDTH = 4;
+
+		static Register load(const double* p) { return _mm256_loadu_pd(p); }
+		static void store(double* p, const Register r) { _mm256_storeu_pd(p, r); }
+		static Register set1(const double value) { return _mm256_set1_pd(value); }
+		static Register add(const Register a, const Register b) { return _mm256_add_pd(a, b); }
+		static Register sub(const Register a, const Register b) { return _mm256_sub_pd(a, b); }
+		static Register mul(const Register a, const Register b) { return _mm256_mul_pd(a, b); }
+		static Register div(const Register a, const Register b) { return _mm256_div_pd(a, b); }
+		static Register sqrt(const Register a) { return _mm256_sqrt_pd(a); }
+		static Register min(const Register a, const Register b) { return _mm256_min_pd(a, b); }
+		static Register max(const Register a, const Register b) { return _mm256_max_pd(a, b); }
+
+		// Comparisons give a Mask with every bit of a lane set where the comparison holds
+		using Mask = Register;
+
+		static Mask less(const Register a, const Register b) { return _mm256_cmp_pd(a, b, _CMP_LT_OQ); }
+		static Mask less_equal(const Register a, const Register b) { return _mm256_cmp_pd(a, b, _CMP_LE_OQ); }
+		static Mask greater(const Register a, const Register b) { return _mm256_cmp_pd(a, b, _CMP_GT_OQ); }
+		static Mask greater_equal(const Register a, const Register b) { return _mm256_cmp_pd(a, b, _CMP_GE_OQ); }
+		static Mask equal_to(const Register a, const Register b) { return _mm256_cmp_pd(a, b, _CMP_EQ_OQ); }
+		static Mask mask_and(const Mask a, const Mask b) { return _mm256_and_pd(a, b); }
+		static Mask mask_or(const Mask a, const Mask b) { return _mm256_or_pd(a, b); }
+		static Mask mask_not(const Mask a) { return _mm256_xor_pd(a, _mm256_castsi256_pd(_mm256_set1_epi32(-1))); }
+		static int mask_bits(const Mask a) { return _mm256_movemask_pd(a); }
+
+		/// <summary>
+		/// Takes each lane from a where mask is set, else from b
+		/// </summary>
+		static Register select(const Mask mask, const Register a, const Register b) { return _mm256_blendv_pd(b, a, mask); }
+	};
+
+	template<>
+	struct Pack<float>
+	{
+		using Register = __m256;
+		static constexpr int WIDTH = 8;
+
+		static Register load(const float* p) { return _mm256_loadu_ps(p); }
+		static void store(float* p, const Register r) { _mm256_storeu_ps(p, r); }
+		static Register set1(const float value) { return _mm256_set1_ps(value); }
+		static Register add(const Register a, const Register b) { return _mm256_add_ps(a, b); }
+		static Register sub(const Register a, const Register b) { return _mm256_sub_ps(a, b); }
+		static Register mul(const Register a, const Register b) { return _mm256_mul_ps(a, b); }
+		static Register div(const Register a, const Register b) { return _mm256_div_ps(a, b); }
+		static Register sqrt(const Register a) { return _mm256_sqrt_ps(a); }
+		static Register min(const Register a, const Register b) { return _mm256_min_ps(a, b); }
+		static Register max(const Register a, const Register b) { return _mm256_max_ps(a, b); }
+
+		// Comparisons give a Mask with every bit of a lane set where the comparison holds
+		using Mask = Register;
+
+		static Mask less(const Register a, const Register b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+		static Mask less_equal(const Register a, const Register b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+		static Mask greater(const Register a, const Register b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+		static Mask greater_equal(const Register a, const Register b) { return _mm256_cmp_ps(a, b, _CMP_GE_OQ); }
+		static Mask equal_to(const Register a, const Register b) { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+		static Mask mask_and(const Mask a, const Mask b) { return _mm256_and_ps(a, b); }
+		static Mask mask_or(const Mask a, const Mask b) { return _mm256_or_ps(a, b); }
+		static Mask mask_not(const Mask a) { return _mm256_xor_ps(a, _mm256_castsi256_ps(_mm256_set1_epi32(-1))); }
+		static int mask_bits(const Mask a) { return _mm256_movemask_ps(a); }
+
+		/// <summary>
+		/// Takes each lane from a where mask is set, else from b
+		/// </summary>
+		static Register select(const Mask mask, const Register a, const Register b) { return _mm256_blendv_ps(b, a, mask); }
+	};
+#elif defined(RML_SSE2)
+	template<>
+	struct Pack<double>
+	{
+		using Register = __m128d;
+		static constexpr int WIDTH = 2;
+
+		static Register load(const double* p) { return _mm_loadu_pd(p); }
+		static void store(double* p, const Register r) { _mm_storeu_pd(p, r); }
+		static Register set1(const double value) { return _mm_set1_pd(value); }
+		static Register add(const Register a, const Register b) { return _mm_add_pd(a, b); }
+		static Register sub(const Register a, const Register b) { return _mm_sub_pd(a, b); }
+		static Register mul(const Register a, const Register b) { return _mm_mul_pd(a, b); }
+		static Register div(const Register a, const Register b) { return _mm_div_pd(a, b); }
+		static Register sqrt(const Register a) { return _mm_sqrt_pd(a); }
+		static Register min(const Register a, const Register b) { return _mm_min_pd(a, b); }
+		static Register max(const Register a, const Register b) { return _mm_max_pd(a, b); }
+
+		// Comparisons give a Mask with every bit of a lane set where the comparison holds
+		using Mask = Register;
+
+		static Mask less(const Register a, const Register b) { return _mm_cmplt_pd(a, b); }
+		static Mask less_equal(const Register a, const Register b) { return _mm_cmple_pd(a, b); }
+		static Mask greater(const Register a, const Register b) { return _mm_cmpgt_pd(a, b); }
+		static Mask greater_equal(const Register a, const Register b) { return _mm_cmpge_pd(a, b); }
+		static Mask equal_to(const Register a, const Register b) { return _mm_cmpeq_pd(a, b); }
+		static Mask mask_and(const Mask a, const Mask b) { return _mm_and_pd(a, b); }
+		static Mask mask_or(const Mask a, const Mask b) { return _mm_or_pd(a, b); }
+		static Mask mask_not(const Mask a) { return _mm_xor_pd(a, _mm_castsi128_pd(_mm_set1_epi32(-1))); }
+		static int mask_bits(const Mask a) { return _mm_movemask_pd(a); }
+
+		/// <summary>
+		/// Takes each lane from a where mask is set, else from b
+		/// </summary>
+		static Register select(const Mask mask, const Register a, const Register b) { return _mm_or_pd(_mm_and_pd(mask, a), _mm_andnot_pd(mask, b)); }
+	};
+
+	template<>
+	struct Pack<float>
+	{
+		using Register = __m128;
+		static constexpr int WIDTH = 4;
+
+		static Register load(const float* p) { return _mm_loadu_ps(p); }
+		static void store(float* p, const Register r) { _mm_storeu_ps(p, r); }
+		static Register set1(const float value) { return _mm_set1_ps(value); }
+		static Register add(const Register a, const Register b) { return _mm_add_ps(a, b); }
+		static Register sub(const Register a, const Register b) { return _mm_sub_ps(a, b); }
+		static Register mul(const Register a, const Register b) { return _mm_mul_ps(a, b); }
+		static Register div(const Register a, const Register b) { return _mm_div_ps(a, b); }
+		static Register sqrt(const Register a) { return _mm_sqrt_ps(a); }
+		static Register min(const Register a, const Register b) { return _mm_min_ps(a, b); }
+		static Register max(const Register a, const Register b) { return _mm_max_ps(a, b); }
+
+		// Comparisons give a Mask with every bit of a lane set where the comparison holds
+		using Mask = Register;
+
+		static Mask less(const Register a, const Register b) { return _mm_cmplt_ps(a, b); }
+		static Mask less_equal(const Register a, const Register b) { return _mm_cmple_ps(a, b); }
+		static Mask greater(const Register a, const Register b) { return _mm_cmpgt_ps(a, b); }
+		static Mask greater_equal(const Register a, const Register b) { return _mm_cmpge_ps(a, b); }
+		static Mask equal_to(const Register a, const Register b) { return _mm_cmpeq_ps(a, b); }
+		static Mask mask_and(const Mask a, const Mask b) { return _mm_and_ps(a, b); }
+		static Mask mask_or(const Mask a, const Mask b) { return _mm_or_ps(a, b); }
+		static Mask mask_not(const Mask a) { return _mm_xor_ps(a, _mm_castsi128_ps(_mm_set1_epi32(-1))); }
+		static int mask_bits(const Mask a) { return _mm_movemask_ps(a); }
+
+		/// <summary>
+		/// Takes each lane from a where mask is set, else from b
+		/// </summary>
+		static Register select(const Mask mask, const Register a, const Register b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+	};
+#endif
+
+	/// <summary>
+	/// A single number with the operations of Pack, for code written once against Pack that also has to work without SIMD
+	/// </summary>
+	template<typename T>
+	struct ScalarPack
+	{
+		using Register = T;
+		using Mask = bool;
+		static constexpr int WIDTH = 1;
+
+		static Register load(const T* p) { return *p; }
+		static void store(T* p, const Register r) { *p = r; }
+		static Register set1(const T value) { return value; }
+		static Register add(const Register a, const Register b) { return a + b; }
+		static Register sub(const Register a, const Register b) { return a - b; }
+		static Register mul(const Register a, const Register b) { return a * b; }
+		static Register div(const Register a, const Register b) { return a / b; }
+		static Register sqrt(const Register a) { return std::sqrt(a); }
+		static Register min(const Register a, const Register b) { return b < a ? b : a; }
+		static Register max(const Register a, const Register b) { return a < b ? b : a; }
+
+		static Mask less(const Register a, const Register b) { return a < b; }
+		static Mask less_equal(const Register a, const Register b) { return a <= b; }
+		static Mask greater(const Register a, const Register b) { return a > b; }
+		static Mask greater_equal(const Register a, const Register b) { return a >= b; }
+		static Mask equal_to(const Register a, const Register b) { return a == b; }
+		static Mask mask_and(const Mask a, const Mask b) { return a && b; }
+		static Mask mask_or(const Mask a, const Mask b) { return a || b; }
+		static Mask mask_not(const Mask a) { return !a; }
+		static int mask_bits(const Mask a) { return a ? 1 : 0; }
+		static Register select(const Mask mask, const Register a, const Register b) { return mask ? a : b; }
+	};
+
+	/// <summary>
+	/// Pack<T> when there is a SIMD register for T, else ScalarPack<T>
+	/// </summary>
+	template<typename T>
+	using PackOrScalar = std::conditional_t<(Pack<T>::WIDTH > 1), Pack<T>, ScalarPack<T>>;
+
+	/// <summary>
+	/// The N numbers of a Vec of T in a SIMD register, with the element-wise operations of a Vec.
+	/// Vecs of 2 or 3 numbers are padded with zeros, and only their own numbers are loaded and stored.
+	/// ENABLED is false when there is no such register for T and N.
+	/// </summary>
+	template<typename T, std::size_t N>
+	struct VecPack
+	{
+		static constexpr bool ENABLED = false;
+	};
+
+#if defined(RML_SSE2)
+	template<std::size_t N>
+	struct VecPack<float, N>
+	{
+		using Register = __m128;
+		static constexpr bool ENABLED = N >= 2 && N <= 4;
+
+		static Register load(const float* p)
+		{
+			if constexpr (N == 4)
+			{
+				return _mm_loadu_ps(p);
+			}
+			else
+			{
+				const __m128 xy = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(p)));
+
+				if constexpr (N == 3)
+				{
+					return _mm_movelh_ps(xy, _mm_load_ss(p + 2));
+				}
+				else
+				{
+					return xy;
+				}
+			}
+		}
+
+		static void store(float* p, const Register r)
+		{
+			if constexpr (N == 4)
+			{
+				_mm_storeu_ps(p, r);
+			}
+			else
+			{
+				_mm_store_sd(reinterpret_cast<double*>(p), _mm_castps_pd(r));
+
+				if constexpr (N == 3)
+				{
+					_mm_store_ss(p + 2, _mm_movehl_ps(r, r));
+				}
+			}
+		}
+
+		static Register set1(const float value) { return _mm_set1_ps(value); }
+		static Register add(const Register a, const Register b) { return _mm_add_ps(a, b); }
+		static Register sub(const Register a, const Register b) { return _mm_sub_ps(a, b); }
+		static Register mul(const Register a, const Register b) { return _mm_mul_ps(a, b); }
+		static Register div(const Register a, const Register b) { return _mm_div_ps(a, b); }
+		static Register min(const Register a, const Register b) { return _mm_min_ps(a, b); }
+		static Register max(const Register a, const Register b) { return _mm_max_ps(a, b); }
+
+		/// <summary>
+		/// Checks that every pair of numbers is equal, or closer than epsilon. Matches RML::equal, infinities included.
+		/// </summary>
+		static bool equal(const Register a, const Register b, const float epsilon)
+		{
+			constexpr int MASK = (1 << N) - 1;
+
+			const __m128 distance = _mm_andnot_ps(_mm_set1_ps(-0.0f), _mm_sub_ps(a, b));
+			const __m128 near = _mm_or_ps(_mm_cmpeq_ps(a, b), _mm_cmplt_ps(distance, _mm_set1_ps(epsilon)));
+
+			return (_mm_movemask_ps(near) & MASK) == MASK;
+		}
+	};
+
+	template<>
+	struct VecPack<double, 2>
+	{
+		using Register = __m128d;
+		static constexpr bool ENABLED = true;
+
+		static Register load(const double* p) { return _mm_loadu_pd(p); }
+		static void store(double* p, const Register r) { _mm_storeu_pd(p, r); }
+		static Register set1(const double value) { return _mm_set1_pd(value); }
+		static Register add(const Register a, const Register b) { return _mm_add_pd(a, b); }
+		static Register sub(const Register a, const Register b) { return _mm_sub_pd(a, b); }
+		static Register mul(const Register a, const Register b) { return _mm_mul_pd(a, b); }
+		static Register div(const Register a, const Register b) { return _mm_div_pd(a, b); }
+		static Register min(const Register a, const Register b) { return _mm_min_pd(a, b); }
+		static Register max(const Register a, const Register b) { return _mm_max_pd(a, b); }
+
+		static bool equal(const Register a, const Register b, const double epsilon)
+		{
+			const __m128d distance = _mm_andnot_pd(_mm_set1_pd(-0.0), _mm_sub_pd(a, b));
+			const __m128d near = _mm_or_pd(_mm_cmpeq_pd(a, b), _mm_cmplt_pd(distance, _mm_set1_pd(epsilon)));
+
+			return _mm_movemask_pd(near) == 0x3;
+		}
+	};
+#endif
+
+#if defined(RML_AVX2)
+	template<std::size_t N>
+	struct VecPack<double, N>
+	{
+		using Register = __m256d;
+		static constexpr bool ENABLED = N == 3 || N == 4;
+
+		static Register load(const double* p)
+		{
+			if constexpr (N == 4)
+			{
+				return _mm256_loadu_pd(p);
+			}
+			else
+			{
+				return _mm256_insertf128_pd(_mm256_castpd128_pd256(_mm_loadu_pd(p)), _mm_load_sd(p + 2), 1);
+			}
+		}
+
+		static void store(double* p, const Register r)
+		{
+			if constexpr (N == 4)
+			{
+				_mm256_storeu_pd(p, r);
+			}
+			else
+			{
+				_mm_storeu_pd(p, _mm256_castpd256_pd128(r));
+				_mm_store_sd(p + 2, _mm256_extractf128_pd(r, 1));
+			}
+		}
+
+		static Register set1(const double value) { return _mm256_set1_pd(value); }
+		static Register add(const Register a, const Register b) { return _mm256_add_pd(a, b); }
+		static Register sub(const Register a, const Register b) { return _mm256_sub_pd(a, b); }
+		static Register mul(const Register a, const Register b) { return _mm256_mul_pd(a, b); }
+		static Register div(const Register a, const Register b) { return _mm256_div_pd(a, b); }
+		static Register min(const Register a, const Register b) { return _mm256_min_pd(a, b); }
+		static Register max(const Register a, const Register b) { return _mm256_max_pd(a, b); }
+
+		static bool equal(const Register a, const Register b, const double epsilon)
+		{
+			constexpr int MASK = (1 << N) - 1;
+
+			const __m256d distance = _mm256_andnot_pd(_mm256_set1_pd(-0.0), _mm256_sub_pd(a, b));
+			const __m256d near = _mm256_or_pd(_mm256_cmp_pd(a, b, _CMP_EQ_OQ), _mm256_cmp_pd(distance, _mm256_set1_pd(epsilon), _CMP_LT_OQ));
+
+			return (_mm256_movemask_pd(near) & MASK) == MASK;
+		}
+	};
+#elif defined(RML_SSE2)
+	/// <summary>
+	/// Without AVX, 3 or 4 doubles take two SSE2 registers
+	/// </summary>
+	template<std::size_t N>
+	struct VecPack<double, N>
+	{
+		struct Register
+		{
+			__m128d low, high;
+		};
+
+		static constexpr bool ENABLED = N == 3 || N == 4;
+
+		static Register load(const double* p)
+		{
+			if constexpr (N == 4)
+			{
+				return { _mm_loadu_pd(p), _mm_loadu_pd(p + 2) };
+			}
+			else
+			{
+				return { _mm_loadu_pd(p), _mm_load_sd(p + 2) };
+			}
+		}
+
+		static void store(double* p, const Register r)
+		{
+			_mm_storeu_pd(p, r.low);
+
+			if constexpr (N == 4)
+			{
+				_mm_storeu_pd(p + 2, r.high);
+			}
+			else
+			{
+				_mm_store_sd(p + 2, r.high);
+			}
+		}
+
+		static Register set1(const double value) { return { _mm_set1_pd(value), _mm_set1_pd(value) }; }
+		static Register add(const Register a, const Register b) { return { _mm_add_pd(a.low, b.low), _mm_add_pd(a.high, b.high) }; }
+		static Register sub(const Register a, const Register b) { return { _mm_sub_pd(a.low, b.low), _mm_sub_pd(a.high, b.high) }; }
+		static Register mul(const Register a, const Register b) { return { _mm_mul_pd(a.low, b.low), _mm_mul_pd(a.high, b.high) }; }
+		static Register div(const Register a, const Register b) { return { _mm_div_pd(a.low, b.low), _mm_div_pd(a.high, b.high) }; }
+		static Register min(const Register a, const Register b) { return { _mm_min_pd(a.low, b.low), _mm_min_pd(a.high, b.high) }; }
+		static Register max(const Register a, const Register b) { return { _mm_max_pd(a.low, b.low), _mm_max_pd(a.high, b.high) }; }
+
+		static bool equal(const Register a, const Register b, const double epsilon)
+		{
+			constexpr int MASK = (1 << N) - 1;
+
+			const __m128d sign = _mm_set1_pd(-0.0);
+			const __m128d e = _mm_set1_pd(epsilon);
+
+			const __m128d low = _mm_or_pd(_mm_cmpeq_pd(a.low, b.low), _mm_cmplt_pd(_mm_andnot_pd(sign, _mm_sub_pd(a.low, b.low)), e));
+			const __m128d high = _mm_or_pd(_mm_cmpeq_pd(a.high, b.high), _mm_cmplt_pd(_mm_andnot_pd(sign, _mm_sub_pd(a.high, b.high)), e));
+
+			return ((_mm_movemask_pd(low) | (_mm_movemask_pd(high) << 2)) & MASK) == MASK;
+		}
+	};
+#endif
+
+	/// <summary>
+	/// Transforms points or vectors stored as separate x, y and z arrays by an affine 4x4 matrix.
+	/// Runs as many points at a time as the SIMD register for T holds. The output arrays may be the input arrays.
+	/// </summary>
+	/// <typeparam name="POINT">True to transform points (w = 1), false to transform vectors (w = 0)</typeparam>
+	/// <param name="m">The affine 4x4 matrix. Only its top three rows are read, so a 3x4 Affine3 can be passed too.</param>
+	/// <param name="count">The amount of points in each array</param>
+	template<bool POINT, typename T>
+	inline void transform_soa(const T* m, const T* x, const T* y, const T* z, T* outX, T* outY, T* outZ, const std::size_t count)
+	{
+		std::size_t i = 0;
+
+		if constexpr (Pack<T>::WIDTH > 1)
+		{
+			using P = Pack<T>;
+			using R = typename P::Register;
+
+			const R m0 = P::set1(m[0]), m1 = P::set1(m[1]), m2 = P::set1(m[2]), m3 = P::set1(m[3]);
+			const R m4 = P::set1(m[4]), m5 = P::set1(m[5]), m6 = P::set1(m[6]), m7 = P::set1(m[7]);
+			const R m8 = P::set1(m[8]), m9 = P::set1(m[9]), m10 = P::set1(m[10]), m11 = P::set1(m[11]);
+
+			for (; i + P::WIDTH <= count; i += P::WIDTH)
+			{
+				const R px = P::load(x + i);
+				const R py = P::load(y + i);
+				const R pz = P::load(z + i);
+
+				R rx = P::add(P::add(P::mul(m0, px), P::mul(m1, py)), P::mul(m2, pz));
+				R ry = P::add(P::add(P::mul(m4, px), P::mul(m5, py)), P::mul(m6, pz));
+				R rz = P::add(P::add(P::mul(m8, px), P::mul(m9, py)), P::mul(m10, pz));
+
+				if constexpr (POINT)
+				{
+					rx = P::add(rx, m3);
+					ry = P::add(ry, m7);
+					rz = P::add(rz, m11);
+				}
+
+				P::store(outX + i, rx);
+				P::store(outY + i, ry);
+				P::store(outZ + i, rz);
+			}
+		}
+
+		for (; i < count; ++i)
+		{
+			const T px = x[i], py = y[i], pz = z[i];
+
+			T rx = m[0] * px + m[1] * py + m[2] * pz;
+			T ry = m[4] * px + m[5] * py + m[6] * pz;
+			T rz = m[8] * px + m[9] * py + m[10] * pz;
+
+			if constexpr (POINT)
+			{
+				rx += m[3];
+				ry += m[7];
+				rz += m[11];
+			}
+
+			outX[i] = rx;
+			outY[i] = ry;
+			outZ[i] = rz;
+		}
+	}
+
+	/// <summary>
+	/// Transforms an array of points or vectors by an affine 4x4 matrix.
+	/// TUPLE must have x(), y(), z() and a TUPLE(x, y, z) constructor, like Point and Vector.
+	/// When a 4-wide register is available, each point is a linear combination of the matrix columns in one register.
+	/// The output array may be the input array.
+	/// </summary>
+	/// <typeparam name="POINT">True to transform points (w = 1), false to transform vectors (w = 0)</typeparam>
+	/// <param name="m">The affine 4x4 matrix. Only its top three rows are read, so a 3x4 Affine3 can be passed too.</param>
+	/// <param name="count">The amount of points</param>
+	template<bool POINT, typename T, class TUPLE>
+	inline void transform_aos(const T* m, const TUPLE* in, TUPLE* out, const std::size_t count)
+	{
+		if constexpr (VecPack<T, 4>::ENABLED)
+		{
+			using P = VecPack<T, 4>;
+			using R = typename P::Register;
+
+			// The w lane of the result is never stored, so the bottom row is not needed
+			alignas(32) T columns[4][4] = {
+				{ m[0], m[4], m[8], 0 },
+				{ m[1], m[5], m[9], 0 },
+				{ m[2], m[6], m[10], 0 },
+				{ m[3], m[7], m[11], 0 }
+			};
+
+			const R c0 = P::load(columns[0]);
+			const R c1 = P::load(columns[1]);
+			const R c2 = P::load(columns[2]);
+			const R c3 = P::load(columns[3]);
+
+			alignas(32) T result[4];
+
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				R r = P::add(P::add(P::mul(c0, P::set1(in[i].x())), P::mul(c1, P::set1(in[i].y()))), P::mul(c2, P::set1(in[i].z())));
+
+				if constexpr (POINT)
+				{
+					r = P::add(r, c3);
+				}
+
+				P::store(result, r);
+				out[i] = TUPLE(result[0], result[1], result[2]);
+			}
+		}
+		else
+		{
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				const T px = in[i].x(), py = in[i].y(), pz = in[i].z();
+
+				if constexpr (POINT)
+				{
+					out[i] = TUPLE(
+						m[0] * px + m[1] * py + m[2] * pz + m[3],
+						m[4] * px + m[5] * py + m[6] * pz + m[7],
+						m[8] * px + m[9] * py + m[10] * pz + m[11]);
+				}
+				else
+				{
+					out[i] = TUPLE(
+						m[0] * px + m[1] * py + m[2] * pz,
+						m[4] * px + m[5] * py + m[6] * pz,
+						m[8] * px + m[9] * py + m[10] * pz);
+				}
+			}
+		}
+	}
+
+	/// <summary>
+	/// Transforms points or vectors whose x, y and z are the first three of every stride numbers, e.g. in an interleaved vertex buffer, by an affine 4x4 matrix.
+	/// Like transform_aos, each point is a linear combination of the matrix columns in one register when a 4-wide register is available.
+	/// The output may be the input.
+	/// </summary>
+	/// <typeparam name="POINT">True to transform points (w = 1), false to transform vectors (w = 0)</typeparam>
+	/// <param name="m">The affine 4x4 matrix. Only its top three rows are read, so a 3x4 Affine3 can be passed too.</param>
+	/// <param name="inStride">The amount of numbers from one input point to the next</param>
+	/// <param name="outStride">The amount of numbers from one output point to the next</param>
+	/// <param name="count">The amount of points</param>
+	template<bool POINT, typename T>
+	inline void transform_strided(const T* m, const T* in, const std::size_t inStride, T* out, const std::size_t outStride, const std::size_t count)
+	{
+		if constexpr (VecPack<T, 4>::ENABLED)
+		{
+			using P = VecPack<T, 4>;
+			using R = typename P::Register;
+
+			// The w lane of the result is never stored, so the bottom row is not needed
+			alignas(32) T columns[4][4] = {
+				{ m[0], m[4], m[8], 0 },
+				{ m[1], m[5], m[9], 0 },
+				{ m[2], m[6], m[10], 0 },
+				{ m[3], m[7], m[11], 0 }
+			};
+
+			const R c0 = P::load(columns[0]);
+			const R c1 = P::load(columns[1]);
+			const R c2 = P::load(columns[2]);
+			const R c3 = P::load(columns[3]);
+
+			alignas(32) T result[4];
+
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				const T* p = in + i * inStride;
+
+				R r = P::add(P::add(P::mul(c0, P::set1(p[0])), P::mul(c1, P::set1(p[1]))), P::mul(c2, P::set1(p[2])));
+
+				if constexpr (POINT)
+				{
+					r = P::add(r, c3);
+				}
+
+				P::store(result, r);
+
+				T* o = out + i * outStride;
+				o[0] = result[0];
+				o[1] = result[1];
+				o[2] = result[2];
+			}
+		}
+		else
+		{
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				const T* p = in + i * inStride;
+				const T px = p[0], py = p[1], pz = p[2];
+
+				T rx = m[0] * px + m[1] * py + m[2] * pz;
+				T ry = m[4] * px + m[5] * py + m[6] * pz;
+				T rz = m[8] * px + m[9] * py + m[10] * pz;
+
+				if constexpr (POINT)
+				{
+					rx += m[3];
+					ry += m[7];
+					rz += m[11];
+				}
+
+				T* o = out + i * outStride;
+				o[0] = rx;
+				o[1] = ry;
+				o[2] = rz;
+			}
+		}
+	}
+}
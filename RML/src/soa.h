@@ -0,0 +1,326 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include "simd.h"
+
+/// <summary>
+/// Element-wise kernels over 3D points and vectors stored as separate x, y and z arrays.
+/// Each kernel works through Pack<T>::WIDTH items at a time, then finishes the remainder one at a time.
+/// Outputs may be the same arrays as the inputs, since every item is read before it is written.
+/// </summary>
+namespace RML::detail
+{
+	/// <summary>
+	/// out = a + b
+	/// </summary>
+	template<typename T>
+	void soa_add(const T* a, const T* b, T* out, const std::size_t count)
+	{
+		std::size_t i = 0;
+
+		if constexpr (Pack<T>::WIDTH > 1)
+		{
+			using P = Pack<T>;
+
+			for (; i + P::WIDTH <= count; i += P::WIDTH)
+			{
+				P::store(out + i, P::add(P::load(a + i), P::load(b + i)));
+			}
+		}
+
+		for (; i < count; ++i)
+		{
+			out[i] = a[i] + b[i];
+		}
+	}
+
+	/// <summary>
+	/// out = a - b
+	/// </summary>
+	template<typename T>
+	void soa_sub(const T* a, const T* b, T* out, const std::size_t count)
+	{
+		std::size_t i = 0;
+
+		if constexpr (Pack<T>::WIDTH > 1)
+		{
+			using P = Pack<T>;
+
+			for (; i + P::WIDTH <= count; i += P::WIDTH)
+			{
+				P::store(out + i, P::sub(P::load(a + i), P::load(b + i)));
+			}
+		}
+
+		for (; i < count; ++i)
+		{
+			out[i] = a[i] - b[i];
+		}
+	}
+
+	/// <summary>
+	/// out = a + value
+	/// </summary>
+	template<typename T>
+	void soa_offset(const T* a, const T value, T* out, const std::size_t count)
+	{
+		std::size_t i = 0;
+
+		if constexpr (Pack<T>::WIDTH > 1)
+		{
+			using P = Pack<T>;
+			const typename P::Register v = P::set1(value);
+
+			for (; i + P::WIDTH <= count; i += P::WIDTH)
+			{
+				P::store(out + i, P::add(P::load(a + i), v));
+			}
+		}
+
+		for (; i < count; ++i)
+		{
+			out[i] = a[i] + value;
+		}
+	}
+
+	/// <summary>
+	/// out = a * scalar
+	/// </summary>
+	template<typename T>
+	void soa_scale(const T* a, const T scalar, T* out, const std::size_t count)
+	{
+		std::size_t i = 0;
+
+		if constexpr (Pack<T>::WIDTH > 1)
+		{
+			using P = Pack<T>;
+			const typename P::Register s = P::set1(scalar);
+
+			for (; i + P::WIDTH <= count; i += P::WIDTH)
+			{
+				P::store(out + i, P::mul(P::load(a + i), s));
+			}
+		}
+
+		for (; i < count; ++i)
+		{
+			out[i] = a[i] * scalar;
+		}
+	}
+
+	/// <summary>
+	/// Writes the dot product of each pair of vectors of a and b to out
+	/// </summary>
+	template<typename T>
+	void soa_dot(const T* ax, const T* ay, const T* az, const T* bx, const T* by, const T* bz, T* out, const std::size_t count)
+	{
+		std::size_t i = 0;
+
+		if constexpr (Pack<T>::WIDTH > 1)
+		{
+			using P = Pack<T>;
+
+			for (; i + P::WIDTH <= count; i += P::WIDTH)
+			{
+				const auto x = P::mul(P::load(ax + i), P::load(bx + i));
+				const auto y = P::mul(P::load(ay + i), P::load(by + i));
+				const auto z = P::mul(P::load(az + i), P::load(bz + i));
+
+				P::store(out + i, P::add(P::add(x, y), z));
+			}
+		}
+
+		for (; i < count; ++i)
+		{
+			out[i] = ax[i] * bx[i] + ay[i] * by[i] + az[i] * bz[i];
+		}
+	}
+
+	/// <summary>
+	/// Writes the cross product of each pair of vectors of a and b to out
+	/// </summary>
+	template<typename T>
+	void soa_cross(const T* ax, const T* ay, const T* az, const T* bx, const T* by, const T* bz, T* outX, T* outY, T* outZ, const std::size_t count)
+	{
+		std::size_t i = 0;
+
+		if constexpr (Pack<T>::WIDTH > 1)
+		{
+			using P = Pack<T>;
+
+			for (; i + P::WIDTH <= count; i += P::WIDTH)
+			{
+				const auto x1 = P::load(ax + i), y1 = P::load(ay + i), z1 = P::load(az + i);
+				const auto x2 = P::load(bx + i), y2 = P::load(by + i), z2 = P::load(bz + i);
+
+				P::store(outX + i, P::sub(P::mul(y1, z2), P::mul(z1, y2)));
+				P::store(outY + i, P::sub(P::mul(z1, x2), P::mul(x1, z2)));
+				P::store(outZ + i, P::sub(P::mul(x1, y2), P::mul(y1, x2)));
+			}
+		}
+
+		for (; i < count; ++i)
+		{
+			const T x1 = ax[i], y1 = ay[i], z1 = az[i];
+			const T x2 = bx[i], y2 = by[i], z2 = bz[i];
+
+			outX[i] = y1 * z2 - z1 * y2;
+			outY[i] = z1 * x2 - x1 * z2;
+			outZ[i] = x1 * y2 - y1 * x2;
+		}
+	}
+
+	/// <summary>
+	/// Writes the magnitude of each vector to out
+	/// </summary>
+	template<typename T>
+	void soa_magnitude(const T* x, const T* y, const T* z, T* out, const std::size_t count)
+	{
+		std::size_t i = 0;
+
+		if constexpr (Pack<T>::WIDTH > 1)
+		{
+			using P = Pack<T>;
+
+			for (; i + P::WIDTH <= count; i += P::WIDTH)
+			{
+				const auto px = P::load(x + i), py = P::load(y + i), pz = P::load(z + i);
+
+				P::store(out + i, P::sqrt(P::add(P::add(P::mul(px, px), P::mul(py, py)), P::mul(pz, pz))));
+			}
+		}
+
+		for (; i < count; ++i)
+		{
+			out[i] = std::sqrt(x[i] * x[i] + y[i] * y[i] + z[i] * z[i]);
+		}
+	}
+
+	/// <summary>
+	/// Writes each vector divided by its magnitude to out. Like Vector3::normalized, a zero vector becomes NaN.
+	/// </summary>
+	template<typename T>
+	void soa_normalize(const T* x, const T* y, const T* z, T* outX, T* outY, T* outZ, const std::size_t count)
+	{
+		std::size_t i = 0;
+
+		if constexpr (Pack<T>::WIDTH > 1)
+		{
+			using P = Pack<T>;
+
+			for (; i + P::WIDTH <= count; i += P::WIDTH)
+			{
+				const auto px = P::load(x + i), py = P::load(y + i), pz = P::load(z + i);
+				const auto magnitude = P::sqrt(P::add(P::add(P::mul(px, px), P::mul(py, py)), P::mul(pz, pz)));
+
+				P::store(outX + i, P::div(px, magnitude));
+				P::store(outY + i, P::div(py, magnitude));
+				P::store(outZ + i, P::div(pz, magnitude));
+			}
+		}
+
+		for (; i < count; ++i)
+		{
+			const T px = x[i], py = y[i], pz = z[i];
+			const T magnitude = std::sqrt(px * px + py * py + pz * pz);
+
+			outX[i] = px / magnitude;
+			outY[i] = py / magnitude;
+			outZ[i] = pz / magnitude;
+		}
+	}
+
+	/// <summary>
+	/// The operations soa_reduce combines numbers with, on registers of Pack P and on single numbers
+	/// </summary>
+	struct SoaAdd
+	{
+		template<typename P, typename R> static R pack(const R a, const R b) { return P::add(a, b); }
+		template<typename T> static T scalar(const T a, const T b) { return a + b; }
+	};
+
+	struct SoaMin
+	{
+		template<typename P, typename R> static R pack(const R a, const R b) { return P::min(a, b); }
+		template<typename T> static T scalar(const T a, const T b) { return std::min(a, b); }
+	};
+
+	struct SoaMax
+	{
+		template<typename P, typename R> static R pack(const R a, const R b) { return P::max(a, b); }
+		template<typename T> static T scalar(const T a, const T b) { return std::max(a, b); }
+	};
+
+	/// <summary>
+	/// Combines count numbers with OP, one of SoaAdd, SoaMin or SoaMax.
+	/// The registers are combined lane by lane before the lanes are combined with each other, so sums may round differently to a plain loop.
+	/// </summary>
+	/// <param name="count">The amount of numbers. Must be at least 1.</param>
+	template<class OP, typename T>
+	T soa_reduce(const T* a, const std::size_t count)
+	{
+		std::size_t i = 0;
+		T result = a[0];
+
+		if constexpr (Pack<T>::WIDTH > 1)
+		{
+			using P = Pack<T>;
+
+			if (count >= P::WIDTH)
+			{
+				auto lanes = P::load(a);
+
+				for (i = P::WIDTH; i + P::WIDTH <= count; i += P::WIDTH)
+				{
+					lanes = OP::template pack<P>(lanes, P::load(a + i));
+				}
+
+				T values[P::WIDTH];
+				P::store(values, lanes);
+
+				result = values[0];
+
+				for (int lane = 1; lane < P::WIDTH; ++lane)
+				{
+					result = OP::scalar(result, values[lane]);
+				}
+			}
+		}
+
+		for (i = std::max<std::size_t>(i, 1); i < count; ++i)
+		{
+			result = OP::scalar(result, a[i]);
+		}
+
+		return result;
+	}
+
+	/// <summary>
+	/// Returns the sum of count numbers, at least 1
+	/// </summary>
+	template<typename T>
+	T soa_sum(const T* a, const std::size_t count)
+	{
+		return soa_reduce<SoaAdd>(a, count);
+	}
+
+	/// <summary>
+	/// Returns the smallest of count numbers, at least 1
+	/// </summary>
+	template<typename T>
+	T soa_min(const T* a, const std::size_t count)
+	{
+		return soa_reduce<SoaMin>(a, count);
+	}
+
+	/// <summary>
+	/// Returns the largest of count numbers, at least 1
+	/// </summary>
+	template<typename T>
+	T soa_max(const T* a, const std::size_t count)
+	{
+		return soa_reduce<SoaMax>(a, count);
+	}
+}
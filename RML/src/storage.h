@@ -0,0 +1,138 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+// Matrices with more than RML_MATRIX_HEAP_BYTES of data keep it on the heap instead of the stack
+#if !defined(RML_MATRIX_HEAP_BYTES)
+	#define RML_MATRIX_HEAP_BYTES 16384
+#endif
+
+namespace RML::detail
+{
+	/// <summary>
+	/// Heap allocations are aligned to a cache line, which also suits every SIMD register
+	/// </summary>
+	constexpr std::size_t HEAP_ALIGNMENT = 64;
+
+	struct AlignedDelete
+	{
+		template<typename T>
+		void operator()(T* p) const
+		{
+			::operator delete[](p, std::align_val_t(HEAP_ALIGNMENT));
+		}
+	};
+
+	template<typename T>
+	using AlignedPtr = std::unique_ptr<T[], AlignedDelete>;
+
+	/// <summary>
+	/// Allocates count numbers aligned to HEAP_ALIGNMENT, initialized to 0
+	/// </summary>
+	template<typename T>
+	AlignedPtr<T> aligned_zeroed(const std::size_t count)
+	{
+		static_assert(std::is_trivially_copyable<T>::value, "Heap storage only holds plain numbers");
+
+		T* p = static_cast<T*>(::operator new[](std::max<std::size_t>(count, 1) * sizeof(T), std::align_val_t(HEAP_ALIGNMENT)));
+		std::fill_n(p, count, T(0));
+
+		return AlignedPtr<T>(p);
+	}
+
+	/// <summary>
+	/// A std::allocator that aligns every allocation to HEAP_ALIGNMENT, so a growable std::vector of numbers starts on a cache line
+	/// </summary>
+	template<typename T>
+	struct AlignedAllocator
+	{
+		using value_type = T;
+
+		AlignedAllocator() = default;
+
+		template<typename U>
+		AlignedAllocator(const AlignedAllocator<U>&) {}
+
+		T* allocate(const std::size_t count)
+		{
+			return static_cast<T*>(::operator new[](count * sizeof(T), std::align_val_t(HEAP_ALIGNMENT)));
+		}
+
+		void deallocate(T* p, std::size_t)
+		{
+			::operator delete[](p, std::align_val_t(HEAP_ALIGNMENT));
+		}
+
+		template<typename U>
+		bool operator==(const AlignedAllocator<U>&) const { return true; }
+
+		template<typename U>
+		bool operator!=(const AlignedAllocator<U>&) const { return false; }
+	};
+
+	/// <summary>
+	/// A fixed amount of numbers on the heap, with the parts of the std::array interface Matrix uses.
+	/// Copies are deep, moves only pass the allocation on.
+	/// </summary>
+	template<typename T, std::size_t N>
+	class HeapArray
+	{
+	public:
+		HeapArray() : m_data(aligned_zeroed<T>(N)) {}
+
+		HeapArray(const std::array<T, N>& data) : m_data(aligned_zeroed<T>(N))
+		{
+			std::copy_n(data.data(), N, m_data.get());
+		}
+
+		HeapArray(const HeapArray& other) : m_data(aligned_zeroed<T>(N))
+		{
+			std::copy_n(other.m_data.get(), N, m_data.get());
+		}
+
+		HeapArray(HeapArray&& other) noexcept = default;
+
+		HeapArray& operator=(const HeapArray& other)
+		{
+			if (this != &other)
+			{
+				if (!m_data)
+				{
+					m_data = aligned_zeroed<T>(N);
+				}
+
+				std::copy_n(other.m_data.get(), N, m_data.get());
+			}
+
+			return *this;
+		}
+
+		HeapArray& operator=(HeapArray&& other) noexcept = default;
+
+		T& operator[](const std::size_t i) { return m_data[i]; }
+		const T& operator[](const std::size_t i) const { return m_data[i]; }
+
+		T* data() { return m_data.get(); }
+		const T* data() const { return m_data.get(); }
+
+		T* begin() { return m_data.get(); }
+		T* end() { return m_data.get() + N; }
+		const T* begin() const { return m_data.get(); }
+		const T* end() const { return m_data.get() + N; }
+
+		static constexpr std::size_t size() { return N; }
+	private:
+		AlignedPtr<T> m_data;
+	};
+
+	/// <summary>
+	/// std::array for small sizes, so small matrices stay trivially copyable and constexpr, else HeapArray
+	/// </summary>
+	template<typename T, std::size_t N>
+	using MatrixStorage = std::conditional_t<(N * sizeof(T) > RML_MATRIX_HEAP_BYTES), HeapArray<T, N>, std::array<T, N>>;
+}
@@ -0,0 +1,590 @@
+#pragma once
+
+#include <array>
+#include "matrix.h"
+#include "tuple3.h"
+#include "tuple4.h"
+#include "quaternion.h"
+#include "affine.h"
+
+namespace RML
+{
+	/// <summary>
+	/// A 4x4 scale matrix, i.e. a diagonal matrix of x, y, z and 1, stored as its 3 scale factors.
+	/// Multiplying a Matrix by it scales rows or columns instead of doing a dense product.
+	/// </summary>
+	/// <typeparam name="T">The type of number to store, e.g. float, double...</typeparam>
+	template<class T>
+	class ScaleMatrix
+	{
+	public:
+		/// <summary>
+		/// Creates a ScaleMatrix that scales by 1 along every axis
+		/// </summary>
+		constexpr ScaleMatrix() : m_x(1), m_y(1), m_z(1) {}
+
+		/// <summary>
+		/// Creates a ScaleMatrix that scales the same along every axis
+		/// </summary>
+		/// <param name="scale">The scale along every axis</param>
+		explicit constexpr ScaleMatrix(const T scale) : m_x(scale), m_y(scale), m_z(scale) {}
+
+		/// <summary>
+		/// Creates a ScaleMatrix
+		/// </summary>
+		/// <param name="x">Scale along the X axis</param>
+		/// <param name="y">Scale along the Y axis</param>
+		/// <param name="z">Scale along the Z axis</param>
+		constexpr ScaleMatrix(const T x, const T y, const T z) : m_x(x), m_y(y), m_z(z) {}
+
+		constexpr T x() const { return m_x; }
+		constexpr T y() const { return m_y; }
+		constexpr T z() const { return m_z; }
+
+		/// <summary>
+		/// Creates the ScaleMatrix that undoes this one
+		/// </summary>
+		constexpr ScaleMatrix inverse() const
+		{
+			return ScaleMatrix(1 / m_x, 1 / m_y, 1 / m_z);
+		}
+
+		/// <summary>
+		/// Returns the scale as an Affine3
+		/// </summary>
+		constexpr Affine3<T> affine() const
+		{
+			return Affine3<T>({
+				m_x, 0, 0, 0,
+				0, m_y, 0, 0,
+				0, 0, m_z, 0
+			});
+		}
+
+		/// <summary>
+		/// Returns the scale as a dense 4x4 Matrix
+		/// </summary>
+		template<Layout LAYOUT = Layout::RowMajor>
+		constexpr Matrix<T, 4, 4, LAYOUT> matrix() const
+		{
+			return affine().template matrix<LAYOUT>();
+		}
+
+		constexpr ScaleMatrix operator*(const ScaleMatrix& other) const
+		{
+			return ScaleMatrix(m_x * other.m_x, m_y * other.m_y, m_z * other.m_z);
+		}
+
+		constexpr Tuple4<T> operator*(const Tuple4<T>& tuple) const
+		{
+			return Tuple4<T>(m_x * tuple.x(), m_y * tuple.y(), m_z * tuple.z(), tuple.w());
+		}
+
+		/// <summary>
+		/// Scales the top three rows of the Matrix
+		/// </summary>
+		template<Layout LAYOUT>
+		constexpr Matrix<T, 4, 4, LAYOUT> operator*(const Matrix<T, 4, 4, LAYOUT>& matrix) const
+		{
+			const auto& m = matrix;
+
+			return Matrix<T, 4, 4, LAYOUT>({
+				m(0, 0) * m_x, m(0, 1) * m_x, m(0, 2) * m_x, m(0, 3) * m_x,
+				m(1, 0) * m_y, m(1, 1) * m_y, m(1, 2) * m_y, m(1, 3) * m_y,
+				m(2, 0) * m_z, m(2, 1) * m_z, m(2, 2) * m_z, m(2, 3) * m_z,
+				m(3, 0),       m(3, 1),       m(3, 2),       m(3, 3)
+			});
+		}
+
+		/// <summary>
+		/// Scales the rows of the Affine3
+		/// </summary>
+		constexpr Affine3<T> operator*(const Affine3<T>& affine) const
+		{
+			const T* a = affine.data();
+
+			return Affine3<T>({
+				a[0] * m_x, a[1] * m_x, a[2] * m_x, a[3] * m_x,
+				a[4] * m_y, a[5] * m_y, a[6] * m_y, a[7] * m_y,
+				a[8] * m_z, a[9] * m_z, a[10] * m_z, a[11] * m_z
+			});
+		}
+
+		constexpr bool operator==(const ScaleMatrix& other) const
+		{
+			return equal(m_x, other.m_x) && equal(m_y, other.m_y) && equal(m_z, other.m_z);
+		}
+
+		constexpr bool operator!=(const ScaleMatrix& other) const
+		{
+			return !(*this == other);
+		}
+	private:
+		T m_x, m_y, m_z;
+	};
+
+	/// <summary>
+	/// A 4x4 translation matrix, i.e. the identity with x, y and z in the last column, stored as its 3 offsets.
+	/// Multiplying a Matrix by it adds to a row or column instead of doing a dense product.
+	/// </summary>
+	/// <typeparam name="T">The type of number to store, e.g. float, double...</typeparam>
+	template<class T>
+	class TranslationMatrix
+	{
+	public:
+		/// <summary>
+		/// Creates a TranslationMatrix that does not move anything
+		/// </summary>
+		constexpr TranslationMatrix() : m_x(0), m_y(0), m_z(0) {}
+
+		/// <summary>
+		/// Creates a TranslationMatrix
+		/// </summary>
+		/// <param name="x">X translation</param>
+		/// <param name="y">Y translation</param>
+		/// <param name="z">Z translation</param>
+		constexpr TranslationMatrix(const T x, const T y, const T z) : m_x(x), m_y(y), m_z(z) {}
+
+		/// <summary>
+		/// Creates a TranslationMatrix
+		/// </summary>
+		/// <param name="translation">The x, y and z translation</param>
+		constexpr TranslationMatrix(const Tuple3<T>& translation) : m_x(translation.x()), m_y(translation.y()), m_z(translation.z()) {}
+
+		constexpr T x() const { return m_x; }
+		constexpr T y() const { return m_y; }
+		constexpr T z() const { return m_z; }
+
+		/// <summary>
+		/// Creates the TranslationMatrix that undoes this one
+		/// </summary>
+		constexpr TranslationMatrix inverse() const
+		{
+			return TranslationMatrix(-m_x, -m_y, -m_z);
+		}
+
+		/// <summary>
+		/// Returns the translation as an Affine3
+		/// </summary>
+		constexpr Affine3<T> affine() const
+		{
+			return Affine3<T>({
+				1, 0, 0, m_x,
+				0, 1, 0, m_y,
+				0, 0, 1, m_z
+			});
+		}
+
+		/// <summary>
+		/// Returns the translation as a dense 4x4 Matrix
+		/// </summary>
+		template<Layout LAYOUT = Layout::RowMajor>
+		constexpr Matrix<T, 4, 4, LAYOUT> matrix() const
+		{
+			return affine().template matrix<LAYOUT>();
+		}
+
+		constexpr TranslationMatrix operator*(const TranslationMatrix& other) const
+		{
+			return TranslationMatrix(m_x + other.m_x, m_y + other.m_y, m_z + other.m_z);
+		}
+
+		constexpr Tuple4<T> operator*(const Tuple4<T>& tuple) const
+		{
+			const T w = tuple.w();
+			return Tuple4<T>(tuple.x() + m_x * w, tuple.y() + m_y * w, tuple.z() + m_z * w, w);
+		}
+
+		/// <summary>
+		/// Adds the bottom row of the Matrix, times the translation, to the top three rows.
+		/// When the Matrix is affine this only adds the translation to the last column.
+		/// </summary>
+		template<Layout LAYOUT>
+		constexpr Matrix<T, 4, 4, LAYOUT> operator*(const Matrix<T, 4, 4, LAYOUT>& matrix) const
+		{
+			const auto& m = matrix;
+
+			return Matrix<T, 4, 4, LAYOUT>({
+				m(0, 0) + m_x * m(3, 0), m(0, 1) + m_x * m(3, 1), m(0, 2) + m_x * m(3, 2), m(0, 3) + m_x * m(3, 3),
+				m(1, 0) + m_y * m(3, 0), m(1, 1) + m_y * m(3, 1), m(1, 2) + m_y * m(3, 2), m(1, 3) + m_y * m(3, 3),
+				m(2, 0) + m_z * m(3, 0), m(2, 1) + m_z * m(3, 1), m(2, 2) + m_z * m(3, 2), m(2, 3) + m_z * m(3, 3),
+				m(3, 0),                 m(3, 1),                 m(3, 2),                 m(3, 3)
+			});
+		}
+
+		/// <summary>
+		/// Adds the translation to the last column of the Affine3
+		/// </summary>
+		constexpr Affine3<T> operator*(const Affine3<T>& affine) const
+		{
+			const T* a = affine.data();
+
+			return Affine3<T>({
+				a[0], a[1], a[2], a[3] + m_x,
+				a[4], a[5], a[6], a[7] + m_y,
+				a[8], a[9], a[10], a[11] + m_z
+			});
+		}
+
+		constexpr bool operator==(const TranslationMatrix& other) const
+		{
+			return equal(m_x, other.m_x) && equal(m_y, other.m_y) && equal(m_z, other.m_z);
+		}
+
+		constexpr bool operator!=(const TranslationMatrix& other) const
+		{
+			return !(*this == other);
+		}
+	private:
+		T m_x, m_y, m_z;
+	};
+
+	/// <summary>
+	/// A 4x4 rotation matrix, stored as its upper 3x3 rotation.
+	/// Multiplying a Matrix by it only touches the top three rows or the left three columns.
+	/// </summary>
+	/// <typeparam name="T">The type of number to store, e.g. float, double...</typeparam>
+	template<class T>
+	class RotationMatrix3
+	{
+	public:
+		/// <summary>
+		/// Creates a RotationMatrix3 that does not rotate
+		/// </summary>
+		constexpr RotationMatrix3() : m_rotation(Matrix<T, 3, 3>::identity()) {}
+
+		/// <summary>
+		/// Creates a RotationMatrix3 from an orthonormal 3x3 Matrix. The Matrix is not checked.
+		/// </summary>
+		/// <param name="rotation">The rotation</param>
+		explicit constexpr RotationMatrix3(const Matrix<T, 3, 3>& rotation) : m_rotation(rotation) {}
+
+		/// <summary>
+		/// Creates a RotationMatrix3 from a Quaternion
+		/// </summary>
+		/// <param name="rotation">The rotation</param>
+		explicit RotationMatrix3(const Quaternion& rotation) : m_rotation(from_quaternion(rotation)) {}
+
+		/// <summary>
+		/// Accesses the value at row, column of the 3x3 rotation
+		/// </summary>
+		constexpr T operator() (const int row, const int column) const
+		{
+			return m_rotation(row, column);
+		}
+
+		/// <summary>
+		/// Returns the 3x3 rotation
+		/// </summary>
+		constexpr const Matrix<T, 3, 3>& rotation() const
+		{
+			return m_rotation;
+		}
+
+		/// <summary>
+		/// Creates the RotationMatrix3 that undoes this one, by transposing it
+		/// </summary>
+		constexpr RotationMatrix3 inverse() const
+		{
+			return RotationMatrix3(m_rotation.transpose());
+		}
+
+		/// <summary>
+		/// Returns the rotation as an Affine3
+		/// </summary>
+		constexpr Affine3<T> affine() const
+		{
+			return Affine3<T>(m_rotation, Tuple3<T>());
+		}
+
+		/// <summary>
+		/// Returns the rotation as a dense 4x4 Matrix
+		/// </summary>
+		template<Layout LAYOUT = Layout::RowMajor>
+		constexpr Matrix<T, 4, 4, LAYOUT> matrix() const
+		{
+			return affine().template matrix<LAYOUT>();
+		}
+
+		constexpr RotationMatrix3 operator*(const RotationMatrix3& other) const
+		{
+			return RotationMatrix3(m_rotation * other.m_rotation);
+		}
+
+		constexpr Tuple4<T> operator*(const Tuple4<T>& tuple) const
+		{
+			const auto& r = m_rotation;
+			const T x = tuple.x(), y = tuple.y(), z = tuple.z();
+
+			return Tuple4<T>(
+				r(0, 0) * x + r(0, 1) * y + r(0, 2) * z,
+				r(1, 0) * x + r(1, 1) * y + r(1, 2) * z,
+				r(2, 0) * x + r(2, 1) * y + r(2, 2) * z,
+				tuple.w()
+			);
+		}
+
+		/// <summary>
+		/// Rotates the top three rows of the Matrix. The bottom row is unchanged.
+		/// </summary>
+		template<Layout LAYOUT>
+		constexpr Matrix<T, 4, 4, LAYOUT> operator*(const Matrix<T, 4, 4, LAYOUT>& matrix) const
+		{
+			std::array<T, 16> result = {};
+
+			for (int row = 0; row < 3; ++row)
+			{
+				for (int col = 0; col < 4; ++col)
+				{
+					result[row * 4 + col] = m_rotation(row, 0) * matrix(0, col) + m_rotation(row, 1) * matrix(1, col) + m_rotation(row, 2) * matrix(2, col);
+				}
+			}
+
+			for (int col = 0; col < 4; ++col)
+			{
+				result[12 + col] = matrix(3, col);
+			}
+
+			return Matrix<T, 4, 4, LAYOUT>(result);
+		}
+
+		/// <summary>
+		/// Rotates the linear part and the translation of the Affine3
+		/// </summary>
+		constexpr Affine3<T> operator*(const Affine3<T>& affine) const
+		{
+			std::array<T, 12> result = {};
+			const T* a = affine.data();
+
+			for (int row = 0; row < 3; ++row)
+			{
+				for (int col = 0; col < 4; ++col)
+				{
+					result[row * 4 + col] = m_rotation(row, 0) * a[col] + m_rotation(row, 1) * a[4 + col] + m_rotation(row, 2) * a[8 + col];
+				}
+			}
+
+			return Affine3<T>(result);
+		}
+
+		constexpr bool operator==(const RotationMatrix3& other) const
+		{
+			return m_rotation == other.m_rotation;
+		}
+
+		constexpr bool operator!=(const RotationMatrix3& other) const
+		{
+			return !(*this == other);
+		}
+	private:
+		// The upper 3x3 of Quaternion::matrix(), written out so the numbers stay in registers
+		static Matrix<T, 3, 3> from_quaternion(const Quaternion& q)
+		{
+			const double w = q.w(), i = q.i(), j = q.j(), k = q.k();
+
+			return Matrix<T, 3, 3>({
+				static_cast<T>(1 - 2 * (j * j + k * k)), static_cast<T>(2 * (i * j - k * w)), static_cast<T>(2 * (i * k + j * w)),
+				static_cast<T>(2 * (i * j + k * w)), static_cast<T>(1 - 2 * (i * i + k * k)), static_cast<T>(2 * (j * k - i * w)),
+				static_cast<T>(2 * (i * k - j * w)), static_cast<T>(2 * (j * k + i * w)), static_cast<T>(1 - 2 * (i * i + j * j))
+			});
+		}
+
+		Matrix<T, 3, 3> m_rotation;
+	};
+
+	/// <summary>
+	/// Scales the left three columns of the Matrix
+	/// </summary>
+	template<class T, Layout LAYOUT>
+	constexpr Matrix<T, 4, 4, LAYOUT> operator*(const Matrix<T, 4, 4, LAYOUT>& matrix, const ScaleMatrix<T>& scale)
+	{
+		const auto& m = matrix;
+		const T x = scale.x(), y = scale.y(), z = scale.z();
+
+		return Matrix<T, 4, 4, LAYOUT>({
+			m(0, 0) * x, m(0, 1) * y, m(0, 2) * z, m(0, 3),
+			m(1, 0) * x, m(1, 1) * y, m(1, 2) * z, m(1, 3),
+			m(2, 0) * x, m(2, 1) * y, m(2, 2) * z, m(2, 3),
+			m(3, 0) * x, m(3, 1) * y, m(3, 2) * z, m(3, 3)
+		});
+	}
+
+	/// <summary>
+	/// Scales the left three columns of the Affine3
+	/// </summary>
+	template<class T>
+	constexpr Affine3<T> operator*(const Affine3<T>& affine, const ScaleMatrix<T>& scale)
+	{
+		const T* a = affine.data();
+		const T x = scale.x(), y = scale.y(), z = scale.z();
+
+		return Affine3<T>({
+			a[0] * x, a[1] * y, a[2] * z, a[3],
+			a[4] * x, a[5] * y, a[6] * z, a[7],
+			a[8] * x, a[9] * y, a[10] * z, a[11]
+		});
+	}
+
+	/// <summary>
+	/// Adds the left three columns of the Matrix, times the translation, to the last column
+	/// </summary>
+	template<class T, Layout LAYOUT>
+	constexpr Matrix<T, 4, 4, LAYOUT> operator*(const Matrix<T, 4, 4, LAYOUT>& matrix, const TranslationMatrix<T>& translation)
+	{
+		const auto& m = matrix;
+		const T x = translation.x(), y = translation.y(), z = translation.z();
+
+		return Matrix<T, 4, 4, LAYOUT>({
+			m(0, 0), m(0, 1), m(0, 2), m(0, 0) * x + m(0, 1) * y + m(0, 2) * z + m(0, 3),
+			m(1, 0), m(1, 1), m(1, 2), m(1, 0) * x + m(1, 1) * y + m(1, 2) * z + m(1, 3),
+			m(2, 0), m(2, 1), m(2, 2), m(2, 0) * x + m(2, 1) * y + m(2, 2) * z + m(2, 3),
+			m(3, 0), m(3, 1), m(3, 2), m(3, 0) * x + m(3, 1) * y + m(3, 2) * z + m(3, 3)
+		});
+	}
+
+	/// <summary>
+	/// Adds the linear part of the Affine3, times the translation, to its translation
+	/// </summary>
+	template<class T>
+	constexpr Affine3<T> operator*(const Affine3<T>& affine, const TranslationMatrix<T>& translation)
+	{
+		const T* a = affine.data();
+		const T x = translation.x(), y = translation.y(), z = translation.z();
+
+		return Affine3<T>({
+			a[0], a[1], a[2], a[0] * x + a[1] * y + a[2] * z + a[3],
+			a[4], a[5], a[6], a[4] * x + a[5] * y + a[6] * z + a[7],
+			a[8], a[9], a[10], a[8] * x + a[9] * y + a[10] * z + a[11]
+		});
+	}
+
+	/// <summary>
+	/// Rotates the left three columns of the Matrix. The last column is unchanged.
+	/// </summary>
+	template<class T, Layout LAYOUT>
+	constexpr Matrix<T, 4, 4, LAYOUT> operator*(const Matrix<T, 4, 4, LAYOUT>& matrix, const RotationMatrix3<T>& rotation)
+	{
+		std::array<T, 16> result = {};
+
+		for (int row = 0; row < 4; ++row)
+		{
+			for (int col = 0; col < 3; ++col)
+			{
+				result[row * 4 + col] = matrix(row, 0) * rotation(0, col) + matrix(row, 1) * rotation(1, col) + matrix(row, 2) * rotation(2, col);
+			}
+
+			result[row * 4 + 3] = matrix(row, 3);
+		}
+
+		return Matrix<T, 4, 4, LAYOUT>(result);
+	}
+
+	/// <summary>
+	/// Rotates the linear part of the Affine3. The translation is unchanged.
+	/// </summary>
+	template<class T>
+	constexpr Affine3<T> operator*(const Affine3<T>& affine, const RotationMatrix3<T>& rotation)
+	{
+		std::array<T, 12> result = {};
+		const T* a = affine.data();
+
+		for (int row = 0; row < 3; ++row)
+		{
+			for (int col = 0; col < 3; ++col)
+			{
+				result[row * 4 + col] = a[row * 4 + 0] * rotation(0, col) + a[row * 4 + 1] * rotation(1, col) + a[row * 4 + 2] * rotation(2, col);
+			}
+
+			result[row * 4 + 3] = a[row * 4 + 3];
+		}
+
+		return Affine3<T>(result);
+	}
+
+	// Products of two different structured matrices are affine, and each is written out without a dense product
+
+	/// <summary>
+	/// Scales the rows of the rotation
+	/// </summary>
+	template<class T>
+	constexpr Affine3<T> operator*(const ScaleMatrix<T>& scale, const RotationMatrix3<T>& rotation)
+	{
+		const auto& r = rotation;
+		const T x = scale.x(), y = scale.y(), z = scale.z();
+
+		return Affine3<T>({
+			r(0, 0) * x, r(0, 1) * x, r(0, 2) * x, 0,
+			r(1, 0) * y, r(1, 1) * y, r(1, 2) * y, 0,
+			r(2, 0) * z, r(2, 1) * z, r(2, 2) * z, 0
+		});
+	}
+
+	/// <summary>
+	/// Scales the columns of the rotation
+	/// </summary>
+	template<class T>
+	constexpr Affine3<T> operator*(const RotationMatrix3<T>& rotation, const ScaleMatrix<T>& scale)
+	{
+		const auto& r = rotation;
+		const T x = scale.x(), y = scale.y(), z = scale.z();
+
+		return Affine3<T>({
+			r(0, 0) * x, r(0, 1) * y, r(0, 2) * z, 0,
+			r(1, 0) * x, r(1, 1) * y, r(1, 2) * z, 0,
+			r(2, 0) * x, r(2, 1) * y, r(2, 2) * z, 0
+		});
+	}
+
+	/// <summary>
+	/// Places the rotation next to the translation
+	/// </summary>
+	template<class T>
+	constexpr Affine3<T> operator*(const TranslationMatrix<T>& translation, const RotationMatrix3<T>& rotation)
+	{
+		return Affine3<T>(rotation.rotation(), Tuple3<T>(translation.x(), translation.y(), translation.z()));
+	}
+
+	/// <summary>
+	/// Places the rotated translation next to the rotation
+	/// </summary>
+	template<class T>
+	constexpr Affine3<T> operator*(const RotationMatrix3<T>& rotation, const TranslationMatrix<T>& translation)
+	{
+		const auto& r = rotation;
+		const T x = translation.x(), y = translation.y(), z = translation.z();
+
+		return Affine3<T>({
+			r(0, 0), r(0, 1), r(0, 2), r(0, 0) * x + r(0, 1) * y + r(0, 2) * z,
+			r(1, 0), r(1, 1), r(1, 2), r(1, 0) * x + r(1, 1) * y + r(1, 2) * z,
+			r(2, 0), r(2, 1), r(2, 2), r(2, 0) * x + r(2, 1) * y + r(2, 2) * z
+		});
+	}
+
+	/// <summary>
+	/// Places the scale next to the scaled translation
+	/// </summary>
+	template<class T>
+	constexpr Affine3<T> operator*(const ScaleMatrix<T>& scale, const TranslationMatrix<T>& translation)
+	{
+		const T x = scale.x(), y = scale.y(), z = scale.z();
+
+		return Affine3<T>({
+			x, 0, 0, x * translation.x(),
+			0, y, 0, y * translation.y(),
+			0, 0, z, z * translation.z()
+		});
+	}
+
+	/// <summary>
+	/// Places the scale next to the translation
+	/// </summary>
+	template<class T>
+	constexpr Affine3<T> operator*(const TranslationMatrix<T>& translation, const ScaleMatrix<T>& scale)
+	{
+		return Affine3<T>({
+			scale.x(), 0, 0, translation.x(),
+			0, scale.y(), 0, translation.y(),
+			0, 0, scale.z(), translation.z()
+		});
+	}
+}
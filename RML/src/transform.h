@@ -1,8 +1,12 @@
 #pragma once
 
+#include <cstddef>
 #include <stack>
+#include "config.h"
 #include "matrix.h"
 #include "tuple3.h"
+#include "point3.h"
+#include "vector3.h"
 #include "quaternion.h"
 
 namespace RML
@@ -23,6 +27,39 @@ namespace RML
 		/// </summary>
 		Transform(Matrix<double, 4, 4> matrix);
 
+		/// <summary>
+		/// Returns the position of the Transform
+		/// </summary>
+		const Vector& position() const;
+
+		/// <summary>
+		/// Returns the rotation of the Transform
+		/// </summary>
+		const Quaternion& rotation() const;
+
+		/// <summary>
+		/// Returns the scale of the Transform along the x, y and z axes
+		/// </summary>
+		const Vector& scaling() const;
+
+		/// <summary>
+		/// Sets the position of the Transform
+		/// </summary>
+		/// <param name="position">The new position</param>
+		void set_position(const Vector& position);
+
+		/// <summary>
+		/// Sets the rotation of the Transform
+		/// </summary>
+		/// <param name="rotation">The new rotation</param>
+		void set_rotation(const Quaternion& rotation);
+
+		/// <summary>
+		/// Sets the scale of the Transform along the x, y and z axes
+		/// </summary>
+		/// <param name="scaling">The new scale</param>
+		void set_scaling(const Vector& scaling);
+
 		Vector up() const;
 		Vector down() const;
 		Vector left() const;
@@ -85,16 +122,17 @@ namespace RML
 		const Matrix<double, 4, 4> get_transposed() const;
 
 		/// <summary>
-		/// Inverts the Transform
+		/// Inverts the Transform. The inverse is cached until the Transform changes.
+		/// Unit and uniform scales take a cheaper path than non-uniform scales.
 		/// </summary>
 		/// <returns>The Matrix after being inverted</returns>
-		const Matrix<double, 4, 4> get_inverted() const;
+		const Matrix<double, 4, 4>& get_inverted() const;
 
 		/// <summary>
-		/// Returns the transform as an actual matrix
+		/// Returns the transform as an actual matrix. The matrix is cached until the Transform changes.
 		/// </summary>
 		/// <returns>The transform matrix</returns>
-		const Matrix<double, 4, 4> matrix() const;
+		const Matrix<double, 4, 4>& matrix() const;
 
 		/// <summary>
 		/// Multiplies the Tuple by the Transform, and returns the transformed Tuple
@@ -103,11 +141,102 @@ namespace RML
 		/// <returns>The Tuple after being transformed</returns>
 		Tuple4<double> operator*(const Tuple4<double>& tuple) const;
 
+		/// <summary>
+		/// Transforms the Point by translation, rotation and scale
+		/// </summary>
+		/// <param name="point">The Point to transform</param>
+		/// <returns>The Point after being transformed</returns>
+		Point operator*(const Point& point) const;
+
+		/// <summary>
+		/// Transforms the Vector by rotation and scale. Vectors are not translated.
+		/// </summary>
+		/// <param name="vector">The Vector to transform</param>
+		/// <returns>The Vector after being transformed</returns>
+		Vector operator*(const Vector& vector) const;
+
+		/// <summary>
+		/// Transforms the Point3 by translation, rotation and scale
+		/// </summary>
+		/// <param name="point">The point to transform</param>
+		/// <returns>The point after being transformed</returns>
+		Point3<double> operator*(const Point3<double>& point) const;
+
+		/// <summary>
+		/// Transforms the Vector3 by rotation and scale. Vectors are not translated.
+		/// </summary>
+		/// <param name="vector">The vector to transform</param>
+		/// <returns>The vector after being transformed</returns>
+		Vector3<double> operator*(const Vector3<double>& vector) const;
+
+		/// <summary>
+		/// Transforms an array of Points. The matrix is built once for the whole array.
+		/// </summary>
+		/// <param name="in">The Points to transform</param>
+		/// <param name="out">Receives the transformed Points. May be the same array as in.</param>
+		/// <param name="count">The amount of Points</param>
+		/// <param name="threads">The most threads to split large arrays across. 0 uses every hardware thread.</param>
+		void apply(const Point* in, Point* out, std::size_t count, unsigned int threads = 1) const;
+
+		/// <summary>
+		/// Transforms an array of Vectors. The matrix is built once for the whole array.
+		/// </summary>
+		/// <param name="in">The Vectors to transform</param>
+		/// <param name="out">Receives the transformed Vectors. May be the same array as in.</param>
+		/// <param name="count">The amount of Vectors</param>
+		/// <param name="threads">The most threads to split large arrays across. 0 uses every hardware thread.</param>
+		void apply(const Vector* in, Vector* out, std::size_t count, unsigned int threads = 1) const;
+
+		/// <summary>
+		/// Transforms an array of Point3s. The matrix is built once for the whole array.
+		/// </summary>
+		/// <param name="in">The points to transform</param>
+		/// <param name="out">Receives the transformed points. May be the same array as in.</param>
+		/// <param name="count">The amount of points</param>
+		/// <param name="threads">The most threads to split large arrays across. 0 uses every hardware thread.</param>
+		void apply(const Point3<double>* in, Point3<double>* out, std::size_t count, unsigned int threads = 1) const;
+
+		/// <summary>
+		/// Transforms an array of Vector3s. The matrix is built once for the whole array. Vectors are not translated.
+		/// </summary>
+		/// <param name="in">The vectors to transform</param>
+		/// <param name="out">Receives the transformed vectors. May be the same array as in.</param>
+		/// <param name="count">The amount of vectors</param>
+		/// <param name="threads">The most threads to split large arrays across. 0 uses every hardware thread.</param>
+		void apply(const Vector3<double>* in, Vector3<double>* out, std::size_t count, unsigned int threads = 1) const;
+
+		/// <summary>
+		/// Transforms points stored as separate x, y and z arrays, several points at a time.
+		/// The output arrays may be the input arrays.
+		/// </summary>
+		/// <param name="count">The amount of points in each array</param>
+		/// <param name="threads">The most threads to split large arrays across. 0 uses every hardware thread.</param>
+		void apply(const double* x, const double* y, const double* z, double* outX, double* outY, double* outZ, std::size_t count, unsigned int threads = 1) const;
+
+		/// <summary>
+		/// Transforms vectors stored as separate x, y and z arrays, several vectors at a time.
+		/// Vectors are not translated. The output arrays may be the input arrays.
+		/// </summary>
+		/// <param name="count">The amount of vectors in each array</param>
+		/// <param name="threads">The most threads to split large arrays across. 0 uses every hardware thread.</param>
+		void apply_vectors(const double* x, const double* y, const double* z, double* outX, double* outY, double* outZ, std::size_t count, unsigned int threads = 1) const;
+
 		bool operator==(const Transform& other) const;
 		bool operator!=(const Transform& other) const;
-	public:
-		Vector position;
-		Quaternion rotation;
-		Vector scaling;
+	private:
+		void mark_dirty();
+
+		Vector m_position;
+		Quaternion m_rotation;
+		Vector m_scaling;
+
+		mutable Matrix<double, 4, 4> m_matrix;
+		mutable Matrix<double, 4, 4> m_inverted;
+		mutable bool m_matrixDirty;
+		mutable bool m_invertedDirty;
 	};
 }
+
+#if defined(RML_HEADER_ONLY)
+#include "transform.inl"
+#endif
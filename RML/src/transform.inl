@@ -0,0 +1,311 @@
+#pragma once
+
+#include "transform.h"
+#include "trig.h"
+#include "parallel.h"
+#include "simd.h"
+#include "structured_matrix.h"
+#include <vector>
+
+namespace RML
+{
+	RML_INLINE Transform::Transform() :
+		m_position(),
+		m_rotation(Quaternion::identity()),
+		m_scaling(1, 1, 1),
+		m_matrix(),
+		m_inverted(),
+		m_matrixDirty(true),
+		m_invertedDirty(true) {};
+
+	RML_INLINE Transform::Transform(Matrix<double, 4, 4> matrix) :
+		m_position(),
+		m_rotation(Quaternion::identity()),
+		m_scaling(1, 1, 1),
+		m_matrix(),
+		m_inverted(),
+		m_matrixDirty(true),
+		m_invertedDirty(true)
+	{
+		double posX = matrix(0, 3);
+		double posY = matrix(1, 3);
+		double posZ = matrix(2, 3);
+
+		m_position = Vector(posX, posY, posZ);
+
+		double scaleX = Vector(matrix(0,0), matrix(1,0), matrix(2,0)).magnitude();
+		double scaleY = Vector(matrix(0,1), matrix(1,1), matrix(2,1)).magnitude();
+		double scaleZ = Vector(matrix(0,2), matrix(1,2), matrix(2,2)).magnitude();
+
+		m_scaling = Vector(scaleX, scaleY, scaleZ);
+
+		double rotA = matrix(0,0) / scaleX;
+		double rotB = matrix(0,1) / scaleY;
+		double rotC = matrix(0,2) / scaleZ;
+
+		double rotD = matrix(1,0) / scaleX;
+		double rotE = matrix(1,1) / scaleY;
+		double rotF = matrix(1,2) / scaleZ;
+
+		double rotG = matrix(2,0) / scaleX;
+		double rotH = matrix(2,1) / scaleY;
+		double rotI = matrix(2,2) / scaleZ;
+
+		Matrix<double, 4, 4> rotMatrix({
+			rotA, rotB, rotC, 0,
+			rotD, rotE, rotF, 0,
+			rotG, rotH, rotI, 0,
+			0,    0,    0,    1
+		});
+
+		m_rotation = Quaternion(rotMatrix);
+	}
+
+	RML_INLINE const Vector& Transform::position() const { return m_position; }
+	RML_INLINE const Quaternion& Transform::rotation() const { return m_rotation; }
+	RML_INLINE const Vector& Transform::scaling() const { return m_scaling; }
+
+	RML_INLINE void Transform::set_position(const Vector& position)
+	{
+		m_position = position;
+		mark_dirty();
+	}
+
+	RML_INLINE void Transform::set_rotation(const Quaternion& rotation)
+	{
+		m_rotation = rotation;
+		mark_dirty();
+	}
+
+	RML_INLINE void Transform::set_scaling(const Vector& scaling)
+	{
+		m_scaling = scaling;
+		mark_dirty();
+	}
+
+	RML_INLINE void Transform::mark_dirty()
+	{
+		m_matrixDirty = true;
+		m_invertedDirty = true;
+	}
+
+	RML_INLINE Vector Transform::up() const { return m_rotation.inverse() * Vector::up(); }
+	RML_INLINE Vector Transform::down() const { return m_rotation.inverse() * Vector::down(); }
+	RML_INLINE Vector Transform::left() const { return m_rotation.inverse() * Vector::left(); }
+	RML_INLINE Vector Transform::right() const { return m_rotation.inverse() * Vector::right(); }
+	RML_INLINE Vector Transform::forward() const { return m_rotation.inverse() * Vector::forward(); }
+	RML_INLINE Vector Transform::backward() const { return m_rotation.inverse() * Vector::backward(); }
+
+	RML_INLINE Transform& Transform::translate(const double x, const double y, const double z)
+	{
+		set_position(Tuple3<double>(m_position) + Tuple3<double>(x, y, z));
+		return *this;
+	}
+
+	RML_INLINE Transform& Transform::rotate(const double xDeg, const double yDeg, const double zDeg)
+	{
+		set_rotation(m_rotation * Quaternion::euler_angles(xDeg, yDeg, zDeg));
+		return *this;
+	}
+
+	RML_INLINE Transform& Transform::scale(const double x, const double y, const double z)
+	{
+		set_scaling({ x * m_scaling.x(), y * m_scaling.y(), z * m_scaling.z() });
+		return *this;
+	}
+
+	RML_INLINE void Transform::look_at(RML::Point target)
+	{
+		look_at(target, RML::Vector::forward());
+	}
+
+	RML_INLINE void Transform::look_at(RML::Point target, RML::Vector up)
+	{
+		RML::Vector dirToTarget = RML::Vector(target - m_position).normalized();
+
+		RML::Quaternion fromToRot = RML::Quaternion::from_to(up, dirToTarget);
+
+		RML::Vector actualVec = fromToRot * RML::Vector::forward();
+
+		set_rotation(fromToRot);
+	}
+
+	RML_INLINE void Transform::rotate_around(RML::Vector origin, RML::Vector axisDirection, double angleDegrees)
+	{
+		
+	}
+
+	RML_INLINE const Matrix<double, 4, 4> Transform::get_transposed() const
+	{
+		return matrix().transpose();
+	}
+
+	RML_INLINE const Matrix<double, 4, 4>& Transform::get_inverted() const
+	{
+		if (!m_invertedDirty)
+		{
+			return m_inverted;
+		}
+
+		const double sx = m_scaling.x();
+		const double sy = m_scaling.y();
+		const double sz = m_scaling.z();
+
+		if (sx == 0 || sy == 0 || sz == 0)
+		{
+			// Not invertible, let Matrix report it
+			m_inverted = matrix().invert();
+			m_invertedDirty = false;
+
+			return m_inverted;
+		}
+
+		if (sx == 1 && sy == 1 && sz == 1)
+		{
+			// Only rotation and translation, so the rotation just needs transposing
+			m_inverted = matrix().rigid_inverse();
+			m_invertedDirty = false;
+
+			return m_inverted;
+		}
+
+		if (sx == sy && sy == sz)
+		{
+			// (s * R)^-1 = R^T / s, which is the rigid inverse of s * R with the upper rows divided by s^2
+			m_inverted = matrix().rigid_inverse();
+
+			const double scale = 1 / (sx * sx);
+
+			for (int row = 0; row < 3; ++row)
+			{
+				for (int col = 0; col < 4; ++col)
+				{
+					m_inverted(row, col) *= scale;
+				}
+			}
+
+			m_invertedDirty = false;
+
+			return m_inverted;
+		}
+
+		// (T * R * S)^-1 = S^-1 * R^T * T^-1, which scales the rows of R^T and then adds the translation column
+		const ScaleMatrix<double> scale(sx, sy, sz);
+		const RotationMatrix3<double> rotation(m_rotation);
+		const TranslationMatrix<double> translation(m_position);
+
+		m_inverted = (scale.inverse() * rotation.inverse() * translation.inverse()).matrix();
+		m_invertedDirty = false;
+
+		return m_inverted;
+	}
+
+	RML_INLINE const Matrix<double, 4, 4>& Transform::matrix() const
+	{
+		if (!m_matrixDirty)
+		{
+			return m_matrix;
+		}
+
+		// T * R * S without a dense product: the rotation placed next to the position, then its columns scaled by the scale
+		const TranslationMatrix<double> translation(m_position);
+		const RotationMatrix3<double> rotation(m_rotation);
+		const ScaleMatrix<double> scale(m_scaling.x(), m_scaling.y(), m_scaling.z());
+
+		m_matrix = (translation * rotation * scale).matrix();
+		m_matrixDirty = false;
+
+		return m_matrix;
+	}
+
+	RML_INLINE Tuple4<double> Transform::operator*(const Tuple4<double>& tuple) const
+	{
+		return matrix() * tuple;
+	}
+
+	RML_INLINE Point Transform::operator*(const Point& point) const
+	{
+		return matrix().transform_point(point);
+	}
+
+	RML_INLINE Vector Transform::operator*(const Vector& vector) const
+	{
+		return matrix().transform_vector(vector);
+	}
+
+	RML_INLINE Point3<double> Transform::operator*(const Point3<double>& point) const
+	{
+		const Tuple4<double> result = matrix().transform_point(Tuple4<double>(point.x(), point.y(), point.z(), 1));
+		return Point3<double>(result.x(), result.y(), result.z());
+	}
+
+	RML_INLINE Vector3<double> Transform::operator*(const Vector3<double>& vector) const
+	{
+		const Tuple4<double> result = matrix().transform_vector(Tuple4<double>(vector.x(), vector.y(), vector.z(), 0));
+		return Vector3<double>(result.x(), result.y(), result.z());
+	}
+
+	RML_INLINE void Transform::apply(const Point* in, Point* out, std::size_t count, unsigned int threads) const
+	{
+		const Matrix<double, 4, 4> m = matrix();
+
+		detail::parallel_for(count, threads, [&](std::size_t begin, std::size_t end) {
+			detail::transform_aos<true>(m.data(), in + begin, out + begin, end - begin);
+		});
+	}
+
+	RML_INLINE void Transform::apply(const Vector* in, Vector* out, std::size_t count, unsigned int threads) const
+	{
+		const Matrix<double, 4, 4> m = matrix();
+
+		detail::parallel_for(count, threads, [&](std::size_t begin, std::size_t end) {
+			detail::transform_aos<false>(m.data(), in + begin, out + begin, end - begin);
+		});
+	}
+
+	RML_INLINE void Transform::apply(const Point3<double>* in, Point3<double>* out, std::size_t count, unsigned int threads) const
+	{
+		const Matrix<double, 4, 4> m = matrix();
+
+		detail::parallel_for(count, threads, [&](std::size_t begin, std::size_t end) {
+			detail::transform_aos<true>(m.data(), in + begin, out + begin, end - begin);
+		});
+	}
+
+	RML_INLINE void Transform::apply(const Vector3<double>* in, Vector3<double>* out, std::size_t count, unsigned int threads) const
+	{
+		const Matrix<double, 4, 4> m = matrix();
+
+		detail::parallel_for(count, threads, [&](std::size_t begin, std::size_t end) {
+			detail::transform_aos<false>(m.data(), in + begin, out + begin, end - begin);
+		});
+	}
+
+	RML_INLINE void Transform::apply(const double* x, const double* y, const double* z, double* outX, double* outY, double* outZ, std::size_t count, unsigned int threads) const
+	{
+		const Matrix<double, 4, 4> m = matrix();
+
+		detail::parallel_for(count, threads, [&](std::size_t begin, std::size_t end) {
+			detail::transform_soa<true>(m.data(), x + begin, y + begin, z + begin, outX + begin, outY + begin, outZ + begin, end - begin);
+		});
+	}
+
+	RML_INLINE void Transform::apply_vectors(const double* x, const double* y, const double* z, double* outX, double* outY, double* outZ, std::size_t count, unsigned int threads) const
+	{
+		const Matrix<double, 4, 4> m = matrix();
+
+		detail::parallel_for(count, threads, [&](std::size_t begin, std::size_t end) {
+			detail::transform_soa<false>(m.data(), x + begin, y + begin, z + begin, outX + begin, outY + begin, outZ + begin, end - begin);
+		});
+	}
+
+	RML_INLINE bool Transform::operator==(const Transform& other) const
+	{
+		return matrix() == other.matrix();
+	}
+
+	RML_INLINE bool Transform::operator!=(const Transform& other) const
+	{
+		return !((*this) == other);
+	}
+}
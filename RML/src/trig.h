@@ -12,12 +12,18 @@ namespace RML::Trig
 	/// </summary>
 	/// <param name="degrees">The degrees to convert</param>
 	/// <returns>The radians that correspond to the input degrees</returns>
-	double degrees_to_radians(const double degrees);
+	constexpr double degrees_to_radians(const double degrees)
+	{
+		return degrees * (PI / 180.0);
+	}
 
 	/// <summary>
 	/// Converts radians to degrees
 	/// </summary>
 	/// <param name="radians">The radians to convert</param>
 	/// <returns>The degrees that correspond to the input radians</returns>
-	double radians_to_degrees(const double radians);
+	constexpr double radians_to_degrees(const double radians)
+	{
+		return (radians / PI) * 180.0;
+	}
 }
@@ -0,0 +1,367 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <type_traits>
+#include <utility>
+#include "constants.h"
+#include "comparison.h"
+#include "simd.h"
+
+namespace RML
+{
+	namespace detail
+	{
+		/// <summary>
+		/// Vecs of float and double that take 8, 16 or 32 bytes are aligned to their size, so they load into SIMD registers without crossing a cache line.
+		/// Other Vecs keep the alignment of T, so a Vec of 3 numbers is not padded.
+		/// </summary>
+		template<typename T, std::size_t N>
+		constexpr std::size_t vec_alignment()
+		{
+			constexpr std::size_t size = N * sizeof(T);
+
+			return (std::is_same<T, float>::value || std::is_same<T, double>::value) && (size == 8 || size == 16 || size == 32) ? size : alignof(T);
+		}
+	}
+
+	/// <summary>
+	/// A Tuple with N components, x, y, z and w.
+	/// The element-wise operations are written once for every N, and unroll into N operations at compile time.
+	/// Equality of float and double Vecs, and the arithmetic of those with 2 or 4 components, runs in SIMD registers, apart from in constant expressions.
+	/// Tuple2, Tuple3 and Tuple4 are Vecs with 2, 3 and 4 components.
+	/// </summary>
+	template<typename T, std::size_t N>
+	class alignas(detail::vec_alignment<T, N>()) Vec {
+		static_assert(N >= 2 && N <= 4, "A Vec has 2, 3 or 4 components");
+
+		/// <summary>
+		/// A Vec of 3 numbers is loaded into a register in two parts. The compiler already runs its arithmetic as a pair and a single number,
+		/// which is faster than assembling the register, so only its equality uses SIMD.
+		/// </summary>
+		static constexpr bool SIMD_ARITHMETIC = detail::VecPack<T, N>::ENABLED && N != 3;
+
+	public:
+		/// <summary>
+		/// Creates a Vec where every component is 0
+		/// </summary>
+		constexpr Vec() : m_data{} {}
+
+		/// <summary>
+		/// Creates a Vec with x and y components
+		/// </summary>
+		/// <param name="x">X component</param>
+		/// <param name="y">Y component</param>
+		template<std::size_t M = N, typename = std::enable_if_t<M == 2>>
+		constexpr Vec(const T x, const T y) : m_data{ x, y } {}
+
+		/// <summary>
+		/// Creates a Vec with x, y and z components
+		/// </summary>
+		/// <param name="x">X component</param>
+		/// <param name="y">Y component</param>
+		/// <param name="z">Z component</param>
+		template<std::size_t M = N, typename = std::enable_if_t<M == 3>>
+		constexpr Vec(const T x, const T y, const T z) : m_data{ x, y, z } {}
+
+		/// <summary>
+		/// Creates a Vec with x, y, z and w components
+		/// </summary>
+		/// <param name="x">X component</param>
+		/// <param name="y">Y component</param>
+		/// <param name="z">Z component</param>
+		/// <param name="w">W component. 1 is a point, 0 is a vector</param>
+		template<std::size_t M = N, typename = std::enable_if_t<M == 4>>
+		constexpr Vec(const T x, const T y, const T z, const T w) : m_data{ x, y, z, w } {}
+
+		/// <summary>
+		/// Returns a const X component
+		/// </summary>
+		constexpr T x() const
+		{
+			return m_data[0];
+		}
+
+		/// <summary>
+		/// Returns a const Y component
+		/// </summary>
+		constexpr T y() const
+		{
+			return m_data[1];
+		}
+
+		/// <summary>
+		/// Returns a const Z component
+		/// </summary>
+		constexpr T z() const
+		{
+			static_assert(N >= 3, "Only a Vec with 3 or more components has a Z component");
+			return m_data[2];
+		}
+
+		/// <summary>
+		/// Returns a const W component
+		/// </summary>
+		constexpr T w() const
+		{
+			static_assert(N >= 4, "Only a Vec with 4 components has a W component");
+			return m_data[3];
+		}
+
+		/// <summary>
+		/// Returns the component at index i, where x is 0
+		/// </summary>
+		constexpr T operator[](const std::size_t i) const
+		{
+			return m_data[i];
+		}
+
+		/// <summary>
+		/// Returns a reference to the component at index i, where x is 0
+		/// </summary>
+		constexpr T& operator[](const std::size_t i)
+		{
+			return m_data[i];
+		}
+
+		/// <summary>
+		/// Returns the N contiguous components
+		/// </summary>
+		constexpr const T* data() const
+		{
+			return m_data;
+		}
+
+		constexpr bool operator==(const Vec& other) const
+		{
+			if constexpr (detail::VecPack<T, N>::ENABLED)
+			{
+				if (!detail::is_constant_evaluated())
+				{
+					return detail::VecPack<T, N>::equal(load(), other.load(), EPSILON);
+				}
+			}
+
+			return all_equal(other, std::make_index_sequence<N>{});
+		}
+
+		constexpr bool operator!=(const Vec& other) const
+		{
+			return !(*this == other);
+		}
+
+		constexpr Vec operator+(const Vec& other) const
+		{
+			if constexpr (SIMD_ARITHMETIC)
+			{
+				if (!detail::is_constant_evaluated())
+				{
+					using P = detail::VecPack<T, N>;
+					return from_register(P::add(load(), other.load()));
+				}
+			}
+
+			return zip(*this, other, std::plus<>());
+		}
+
+		constexpr Vec& operator+=(const Vec& other)
+		{
+			*this = *this + other;
+			return *this;
+		}
+
+		constexpr Vec operator-(const Vec& other) const
+		{
+			if constexpr (SIMD_ARITHMETIC)
+			{
+				if (!detail::is_constant_evaluated())
+				{
+					using P = detail::VecPack<T, N>;
+					return from_register(P::sub(load(), other.load()));
+				}
+			}
+
+			return zip(*this, other, std::minus<>());
+		}
+
+		constexpr Vec& operator-=(const Vec& other)
+		{
+			*this = *this - other;
+			return *this;
+		}
+
+		constexpr Vec operator*(const Vec& other) const
+		{
+			if constexpr (SIMD_ARITHMETIC)
+			{
+				if (!detail::is_constant_evaluated())
+				{
+					using P = detail::VecPack<T, N>;
+					return from_register(P::mul(load(), other.load()));
+				}
+			}
+
+			return zip(*this, other, std::multiplies<>());
+		}
+
+		constexpr Vec& operator*=(const Vec& other)
+		{
+			*this = *this * other;
+			return *this;
+		}
+
+		constexpr Vec operator-() const
+		{
+			return Vec() - *this;
+		}
+
+		constexpr Vec operator*(const T scalar) const
+		{
+			if constexpr (SIMD_ARITHMETIC)
+			{
+				if (!detail::is_constant_evaluated())
+				{
+					using P = detail::VecPack<T, N>;
+					return from_register(P::mul(load(), P::set1(scalar)));
+				}
+			}
+
+			return map([scalar](const T value) { return value * scalar; });
+		}
+
+		constexpr Vec& operator*=(const T scalar)
+		{
+			*this = *this * scalar;
+			return *this;
+		}
+
+		constexpr Vec operator/(const T scalar) const
+		{
+			if constexpr (SIMD_ARITHMETIC)
+			{
+				if (!detail::is_constant_evaluated())
+				{
+					using P = detail::VecPack<T, N>;
+					return from_register(P::div(load(), P::set1(scalar)));
+				}
+			}
+
+			return map([scalar](const T value) { return value / scalar; });
+		}
+
+		constexpr Vec& operator/=(const T scalar)
+		{
+			*this = *this / scalar;
+			return *this;
+		}
+
+		/// <summary>
+		/// Returns the smaller of each pair of components
+		/// </summary>
+		static constexpr Vec min(const Vec& a, const Vec& b)
+		{
+			if constexpr (SIMD_ARITHMETIC)
+			{
+				if (!detail::is_constant_evaluated())
+				{
+					return from_register(detail::VecPack<T, N>::min(a.load(), b.load()));
+				}
+			}
+
+			return zip(a, b, [](const T lhs, const T rhs) { return lhs < rhs ? lhs : rhs; });
+		}
+
+		/// <summary>
+		/// Returns the larger of each pair of components
+		/// </summary>
+		static constexpr Vec max(const Vec& a, const Vec& b)
+		{
+			if constexpr (SIMD_ARITHMETIC)
+			{
+				if (!detail::is_constant_evaluated())
+				{
+					return from_register(detail::VecPack<T, N>::max(a.load(), b.load()));
+				}
+			}
+
+			return zip(a, b, [](const T lhs, const T rhs) { return lhs > rhs ? lhs : rhs; });
+		}
+
+		friend std::ostream& operator<<(std::ostream& os, const Vec& vec)
+		{
+			os << vec.m_data[0];
+
+			for (std::size_t i = 1; i < N; ++i)
+			{
+				os << ", " << vec.m_data[i];
+			}
+
+			return os;
+		}
+	protected:
+		T m_data[N];
+
+	private:
+		struct Components {};
+
+		/// <summary>
+		/// Creates a Vec from exactly N components, so a result is built in one go rather than written component by component
+		/// </summary>
+		template<typename... ARGS>
+		constexpr Vec(Components, const ARGS... values) : m_data{ static_cast<T>(values)... } {}
+
+		template<typename OP, std::size_t... I>
+		static constexpr Vec zip(const Vec& a, const Vec& b, const OP op, std::index_sequence<I...>)
+		{
+			return Vec(Components{}, op(a.m_data[I], b.m_data[I])...);
+		}
+
+		/// <summary>
+		/// Applies op to each pair of components of a and b
+		/// </summary>
+		template<typename OP>
+		static constexpr Vec zip(const Vec& a, const Vec& b, const OP op)
+		{
+			return zip(a, b, op, std::make_index_sequence<N>{});
+		}
+
+		template<typename OP, std::size_t... I>
+		constexpr Vec map(const OP op, std::index_sequence<I...>) const
+		{
+			return Vec(Components{}, op(m_data[I])...);
+		}
+
+		/// <summary>
+		/// Applies op to each component
+		/// </summary>
+		template<typename OP>
+		constexpr Vec map(const OP op) const
+		{
+			return map(op, std::make_index_sequence<N>{});
+		}
+
+		template<std::size_t... I>
+		constexpr bool all_equal(const Vec& other, std::index_sequence<I...>) const
+		{
+			return (equal(m_data[I], other.m_data[I]) && ...);
+		}
+
+		/// <summary>
+		/// Loads the components into a SIMD register
+		/// </summary>
+		template<typename P = detail::VecPack<T, N>>
+		typename P::Register load() const
+		{
+			return P::load(m_data);
+		}
+
+		template<typename P = detail::VecPack<T, N>>
+		static Vec from_register(const typename P::Register r)
+		{
+			Vec result;
+			P::store(result.m_data, r);
+			return result;
+		}
+	};
+}
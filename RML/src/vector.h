@@ -1,5 +1,6 @@
 #pragma once
 
+#include "config.h"
 #include "tuple4.h"
 #include "tuple3.h"
 
@@ -14,23 +15,23 @@ namespace RML
 		/// Constructs a Vector with components 0, 0, 0
 		/// Note that this has an undefined direction!
 		/// </summary>
-		Vector();
+		constexpr Vector() : Tuple4<double>(0, 0, 0, 0) {}
 
 		/// <summary>
 		/// Constructs a Vector from a tuple, by copying x, y and z components.
 		/// W component is set to 0.
 		/// </summary>
 		/// <param name="tuple">The tuple to convert to a Vector</param>
-		Vector(const Tuple4 tuple);
+		constexpr Vector(const Tuple4<double> tuple) : Tuple4<double>(tuple.x(), tuple.y(), tuple.z(), 0) {}
 
 		/// <summary>
 		/// Constructs a Vector from a tuple, by copying x, y and z components.
 		/// </summary>
 		/// <param name="tuple">The tuple to convert to a Vector</param>
-		Vector(const Tuple3<double> tuple);
+		constexpr Vector(const Tuple3<double> tuple) : Tuple4<double>(tuple.x(), tuple.y(), tuple.z(), 0) {}
 
 		// Allows implicit conversion of Vector to Tuple3
-		operator Tuple3<double>() const;
+		constexpr operator Tuple3<double>() const { return { x(), y(), z() }; }
 
 		/// <summary>
 		/// Constructs a Vector with x, y and z components
@@ -38,62 +39,62 @@ namespace RML
 		/// <param name="x">X component</param>
 		/// <param name="y">Y component</param>
 		/// <param name="z">Z component</param>
-		Vector(const double x, const double y, const double z);
+		constexpr Vector(const double x, const double y, const double z) : Tuple4<double>(x, y, z, 0) {}
 
 		/// <summary>
 		/// Constructs a Vector with x, y and z components, where z is 0
 		/// </summary>
 		/// <param name="x">X component</param>
 		/// <param name="y">Y component</param>
-		Vector(const double x, const double y);
+		constexpr Vector(const double x, const double y) : Tuple4<double>(x, y, 0, 0) {}
 
 		/// <summary>
 		/// Creates a vector where all components are 0
 		/// </summary>
 		/// <returns>Zero Vector</returns>
-		static Vector zero();
+		static constexpr Vector zero() { return { 0, 0, 0 }; }
 
 		/// <summary>
 		/// Creates a vector where all components are 1
 		/// </summary>
 		/// <returns>One Vector</returns>
-		static Vector one();
+		static constexpr Vector one() { return { 1, 1, 1 }; }
 
 		/// <summary>
 		/// Creates a vector pointing up along the y axis
 		/// </summary>
 		/// <returns>Vector pointing up</returns>
-		static Vector up();
+		static constexpr Vector up() { return { 0, 1, 0 }; }
 
 		/// <summary>
 		/// Creates a vector pointing up along the -y axis
 		/// </summary>
 		/// <returns>Vector pointing down</returns>
-		static Vector down();
+		static constexpr Vector down() { return { 0, -1, 0 }; }
 
 		/// <summary>
 		/// Creates a vector pointing right along the x axis
 		/// </summary>
 		/// <returns>Vector pointing right</returns>
-		static Vector right();
+		static constexpr Vector right() { return { 1, 0, 0 }; }
 
 		/// <summary>
 		/// Creates a vector pointing right along the -x axis
 		/// </summary>
 		/// <returns>Vector pointing left</returns>
-		static Vector left();
+		static constexpr Vector left() { return { -1, 0, 0 }; }
 
 		/// <summary>
 		/// Creates a vector pointing forward along the z axis
 		/// </summary>
 		/// <returns>Vector pointing forward</returns>
-		static Vector forward();
+		static constexpr Vector forward() { return { 0, 0, 1 }; }
 
 		/// <summary>
 		/// Creates a vector pointing forward along the -z axis
 		/// </summary>
 		/// <returns>Vector pointing backward</returns>
-		static Vector backward();
+		static constexpr Vector backward() { return { 0, 0, -1 }; }
 
 		/// <summary>
 		/// Performs a cross product operation and returns the result
@@ -101,7 +102,14 @@ namespace RML
 		/// <param name="a">The first vector</param>
 		/// <param name="b">The second vector</param>
 		/// <returns>A vector cross product</returns>
-		static Vector cross(const Vector& a, const Vector& b);
+		static constexpr Vector cross(const Vector& a, const Vector& b)
+		{
+			return Vector(
+				a.y() * b.z() - a.z() * b.y(),
+				a.z() * b.x() - a.x() * b.z(),
+				a.x() * b.y() - a.y() * b.x()
+			);
+		}
 
 		/// <summary>
 		/// Performs a dot product operation and returns the result
@@ -109,7 +117,12 @@ namespace RML
 		/// <param name="a">The first vector</param>
 		/// <param name="b">The second vector</param>
 		/// <returns>A scalar dot product</returns>
-		static double dot(const Vector& a, const Vector& b);
+		static constexpr double dot(const Vector& a, const Vector& b)
+		{
+			return a.x() * b.x() +
+				a.y() * b.y() +
+				a.z() * b.z();
+		}
 
 		/// <summary>
 		/// Calculates the angle between two normalized vectors
@@ -167,3 +180,7 @@ namespace RML
 		Vector clear_near_zero() const;
 	};
 }
+
+#if defined(RML_HEADER_ONLY)
+#include "vector.inl"
+#endif
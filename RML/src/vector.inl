@@ -0,0 +1,72 @@
+#pragma once
+
+#include "vector.h"
+#include "trig.h"
+#include "comparison.h"
+#include <cmath>
+#include <string>
+#include <cassert>
+
+namespace RML
+{
+	RML_INLINE double Vector::angle(const Vector& a, const Vector& b)
+	{
+		return Trig::radians_to_degrees(
+			atan2(
+				cross(b, a).magnitude(),
+				dot(a, b)
+			)
+		);
+	}
+
+	RML_INLINE double RML::Vector::signed_angle(const Vector& a, const Vector& b, const Vector& axis)
+	{
+		return Trig::radians_to_degrees(
+			atan2(
+				dot(cross(a, b), axis),
+				dot(a, b)
+			)
+		);
+	}
+
+	RML_INLINE Vector Vector::reflect(const Vector& vector, const Vector& normal)
+	{
+		return vector - normal * 2 * dot(vector, normal);
+	}
+
+	RML_INLINE Vector Vector::project(const Vector& p, const Vector& dir)
+	{
+		Vector a = -dir;
+		Vector b = dir;
+
+		Vector ap = p - a;
+		Vector ab = b - a;
+
+		return a + ab * (dot(ap, ab) / dot(ab, ab));
+	}
+
+	RML_INLINE double Vector::magnitude() const
+	{
+		return sqrt(dot(*this, *this));
+	}
+
+	RML_INLINE Vector Vector::normalize()
+	{
+		*this = normalized();
+		return *this;
+	}
+
+	RML_INLINE Vector Vector::normalized() const
+	{
+		return Vector(*this / this->magnitude());
+	}
+
+	RML_INLINE Vector Vector::clear_near_zero() const
+	{
+		auto x = equal(this->x(), 0.0) ? 0.0 : this->x();
+		auto y = equal(this->y(), 0.0) ? 0.0 : this->y();
+		auto z = equal(this->z(), 0.0) ? 0.0 : this->z();
+
+		return Vector(x, y, z);
+	}
+}
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <cmath>
+#include "vec.h"
+#include "vector.h"
+
+namespace RML
+{
+	/// <summary>
+	/// A Vector in Euclidean Space stored as its x, y and z components only, 12 bytes as float and 24 as double.
+	/// Unlike Vector it has no w component: being a vector is part of its type, so Transforms and Affine3s never translate it.
+	/// </summary>
+	template<typename T>
+	class Vector3 : public Vec<T, 3> {
+	public:
+		/// <summary>
+		/// Constructs a Vector3 with components 0, 0, 0
+		/// </summary>
+		constexpr Vector3() : Vec<T, 3>() {}
+
+		/// <summary>
+		/// Constructs a Vector3 with x, y and z components
+		/// </summary>
+		/// <param name="x">X component</param>
+		/// <param name="y">Y component</param>
+		/// <param name="z">Z component</param>
+		constexpr Vector3(const T x, const T y, const T z) : Vec<T, 3>(x, y, z) {}
+
+		/// <summary>
+		/// Constructs a Vector3 from a tuple
+		/// </summary>
+		/// <param name="tuple">The tuple to convert to a Vector3</param>
+		explicit constexpr Vector3(const Tuple3<T>& tuple) : Vec<T, 3>(tuple) {}
+
+		/// <summary>
+		/// Constructs a Vector3 from a Vector, by copying x, y and z components
+		/// </summary>
+		/// <param name="vector">The Vector to convert to a Vector3</param>
+		explicit constexpr Vector3(const Vector& vector) : Vec<T, 3>(static_cast<T>(vector.x()), static_cast<T>(vector.y()), static_cast<T>(vector.z())) {}
+
+		/// <summary>
+		/// Converts to a Vector, with W component 0
+		/// </summary>
+		explicit constexpr operator Vector() const
+		{
+			return Vector(this->x(), this->y(), this->z());
+		}
+
+		constexpr Vector3 operator+(const Vector3& other) const
+		{
+			return Vector3(Vec<T, 3>::operator+(other));
+		}
+
+		constexpr Vector3& operator+=(const Vector3& other)
+		{
+			*this = *this + other;
+			return *this;
+		}
+
+		constexpr Vector3 operator-(const Vector3& other) const
+		{
+			return Vector3(Vec<T, 3>::operator-(other));
+		}
+
+		constexpr Vector3& operator-=(const Vector3& other)
+		{
+			*this = *this - other;
+			return *this;
+		}
+
+		constexpr Vector3 operator-() const
+		{
+			return Vector3(Vec<T, 3>::operator-());
+		}
+
+		constexpr Vector3 operator*(const T scalar) const
+		{
+			return Vector3(Vec<T, 3>::operator*(scalar));
+		}
+
+		constexpr Vector3& operator*=(const T scalar)
+		{
+			*this = *this * scalar;
+			return *this;
+		}
+
+		constexpr Vector3 operator/(const T scalar) const
+		{
+			return Vector3(Vec<T, 3>::operator/(scalar));
+		}
+
+		constexpr Vector3& operator/=(const T scalar)
+		{
+			*this = *this / scalar;
+			return *this;
+		}
+
+		/// <summary>
+		/// Performs a cross product operation and returns the result
+		/// </summary>
+		/// <param name="a">The first vector</param>
+		/// <param name="b">The second vector</param>
+		/// <returns>A vector cross product</returns>
+		static constexpr Vector3 cross(const Vector3& a, const Vector3& b)
+		{
+			return Vector3(
+				a.y() * b.z() - a.z() * b.y(),
+				a.z() * b.x() - a.x() * b.z(),
+				a.x() * b.y() - a.y() * b.x()
+			);
+		}
+
+		/// <summary>
+		/// Performs a dot product operation and returns the result
+		/// </summary>
+		/// <param name="a">The first vector</param>
+		/// <param name="b">The second vector</param>
+		/// <returns>A scalar dot product</returns>
+		static constexpr T dot(const Vector3& a, const Vector3& b)
+		{
+			return a.x() * b.x() +
+				a.y() * b.y() +
+				a.z() * b.z();
+		}
+
+		/// <summary>
+		/// Calculates and returns the magnitude of the vector
+		/// </summary>
+		/// <returns>Magnitude of the vector</returns>
+		T magnitude() const
+		{
+			return std::sqrt(dot(*this, *this));
+		}
+
+		/// <summary>
+		/// Calculates and returns a normalized version of the vector
+		/// </summary>
+		/// <returns>Normalized vector</returns>
+		Vector3 normalized() const
+		{
+			return *this / magnitude();
+		}
+	};
+}
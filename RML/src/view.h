@@ -0,0 +1,469 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <type_traits>
+#include "comparison.h"
+#include "matrix.h"
+#include "parallel.h"
+#include "simd.h"
+#include "tuple4.h"
+
+namespace RML
+{
+	/// <summary>
+	/// A ROW x COL Matrix mapped onto memory it does not own, e.g. a float buffer from a file loader.
+	/// Nothing is copied, so the memory must outlive the view. T is const for a read only view.
+	/// </summary>
+	/// <typeparam name="LAYOUT">Whether the buffer holds the Matrix row by row or column by column</typeparam>
+	template<typename T, int ROW, int COL, Layout LAYOUT = Layout::RowMajor>
+	class MatrixView
+	{
+	public:
+		using Value = std::remove_const_t<T>;
+
+		static constexpr int ROWS = ROW;
+		static constexpr int COLS = COL;
+
+		/// <summary>
+		/// Maps a buffer
+		/// </summary>
+		/// <param name="data">The first number of the Matrix</param>
+		/// <param name="stride">The amount of numbers from the start of one row to the next, or one column to the next for ColumnMajor. Defaults to tightly packed.</param>
+		explicit MatrixView(T* data, const std::size_t stride = LAYOUT == Layout::RowMajor ? COL : ROW)
+			: m_data(data), m_stride(stride)
+		{
+			static_assert(ROW > 0, "ROW is too small");
+			static_assert(COL > 0, "COL is too small");
+		}
+
+		/// <summary>
+		/// A read only view can be made from a writable one
+		/// </summary>
+		template<typename U, typename = std::enable_if_t<std::is_same<const U, T>::value>>
+		MatrixView(const MatrixView<U, ROW, COL, LAYOUT>& other)
+			: m_data(other.data()), m_stride(other.stride())
+		{
+		}
+
+		/// <summary>
+		/// Accesses the value at row, column
+		/// </summary>
+		/// <param name="row">The row to access</param>
+		/// <param name="column">The column to access</param>
+		T& operator() (const int row, const int column) const
+		{
+			if constexpr (LAYOUT == Layout::RowMajor)
+			{
+				return m_data[row * m_stride + column];
+			}
+			else
+			{
+				return m_data[column * m_stride + row];
+			}
+		}
+
+		/// <summary>
+		/// Views the same memory with its rows and columns swapped. Nothing is copied.
+		/// </summary>
+		MatrixView<T, COL, ROW, LAYOUT == Layout::RowMajor ? Layout::ColumnMajor : Layout::RowMajor> transpose() const
+		{
+			return MatrixView<T, COL, ROW, LAYOUT == Layout::RowMajor ? Layout::ColumnMajor : Layout::RowMajor>(m_data, m_stride);
+		}
+
+		/// <summary>
+		/// Copies the viewed values into a Matrix
+		/// </summary>
+		Matrix<Value, ROW, COL> matrix() const
+		{
+			Matrix<Value, ROW, COL> result;
+
+			for (int row = 0; row < ROW; ++row)
+			{
+				for (int col = 0; col < COL; ++col)
+				{
+					result(row, col) = (*this)(row, col);
+				}
+			}
+
+			return result;
+		}
+
+		/// <summary>
+		/// Copies the values of a Matrix into the viewed memory
+		/// </summary>
+		template<class M>
+		void assign(const M& matrix) const
+		{
+			static_assert(!std::is_const<T>::value, "A read only view cannot be assigned to");
+
+			for (int row = 0; row < ROW; ++row)
+			{
+				for (int col = 0; col < COL; ++col)
+				{
+					(*this)(row, col) = matrix(row, col);
+				}
+			}
+		}
+
+		T* data() const { return m_data; }
+		std::size_t stride() const { return m_stride; }
+
+		friend std::ostream& operator<<(std::ostream& os, const MatrixView& view)
+		{
+			return os << view.matrix();
+		}
+	private:
+		T* m_data;
+		std::size_t m_stride;
+	};
+
+	/// <summary>
+	/// Views the data of a Matrix. Writing through the view changes the Matrix.
+	/// </summary>
+	template<typename T, int ROW, int COL, Layout LAYOUT>
+	MatrixView<T, ROW, COL, LAYOUT> view(Matrix<T, ROW, COL, LAYOUT>& matrix)
+	{
+		return MatrixView<T, ROW, COL, LAYOUT>(matrix.data());
+	}
+
+	template<typename T, int ROW, int COL, Layout LAYOUT>
+	MatrixView<const T, ROW, COL, LAYOUT> view(const Matrix<T, ROW, COL, LAYOUT>& matrix)
+	{
+		return MatrixView<const T, ROW, COL, LAYOUT>(matrix.data());
+	}
+
+	namespace detail
+	{
+		template<class M>
+		struct is_matrix_view : std::false_type {};
+
+		template<typename T, int ROW, int COL, Layout LAYOUT>
+		struct is_matrix_view<MatrixView<T, ROW, COL, LAYOUT>> : std::true_type {};
+
+		/// <summary>
+		/// The value type, rows and columns of a Matrix or a MatrixView
+		/// </summary>
+		template<class M>
+		struct shape_of;
+
+		template<typename T, int ROW, int COL, Layout LAYOUT>
+		struct shape_of<Matrix<T, ROW, COL, LAYOUT>>
+		{
+			using Value = T;
+			static constexpr int ROWS = ROW;
+			static constexpr int COLS = COL;
+		};
+
+		template<typename T, int ROW, int COL, Layout LAYOUT>
+		struct shape_of<MatrixView<T, ROW, COL, LAYOUT>>
+		{
+			using Value = std::remove_const_t<T>;
+			static constexpr int ROWS = ROW;
+			static constexpr int COLS = COL;
+		};
+
+		// The operators below need at least one side to be a view, so they never compete with the Matrix operators
+		template<class L, class R>
+		constexpr bool either_view = is_matrix_view<L>::value || is_matrix_view<R>::value;
+	}
+
+	template<class L, class R, typename = std::enable_if_t<detail::either_view<L, R>>>
+	Matrix<typename detail::shape_of<L>::Value, detail::shape_of<L>::ROWS, detail::shape_of<R>::COLS> operator*(const L& lhs, const R& rhs)
+	{
+		using A = detail::shape_of<L>;
+		using B = detail::shape_of<R>;
+
+		static_assert(std::is_same<typename A::Value, typename B::Value>::value, "Both sides of the product must hold the same type");
+		static_assert(A::COLS == B::ROWS, "Matrix has an undefined product, the columns of the left hand side must match the rows of the right hand side");
+
+		Matrix<typename A::Value, A::ROWS, B::COLS> result;
+
+		for (int row = 0; row < A::ROWS; ++row)
+		{
+			for (int col = 0; col < B::COLS; ++col)
+			{
+				typename A::Value value = 0;
+
+				for (int i = 0; i < A::COLS; ++i)
+				{
+					value += lhs(row, i) * rhs(i, col);
+				}
+
+				result(row, col) = value;
+			}
+		}
+
+		return result;
+	}
+
+	/// <summary>
+	/// Multiplies a 4x4 view with a Tuple, treating the Tuple as a column
+	/// </summary>
+	template<typename T, Layout LAYOUT>
+	Tuple4<std::remove_const_t<T>> operator*(const MatrixView<T, 4, 4, LAYOUT>& view, const Tuple4<std::remove_const_t<T>>& tuple)
+	{
+		return Tuple4<std::remove_const_t<T>>(
+			view(0, 0) * tuple.x() + view(0, 1) * tuple.y() + view(0, 2) * tuple.z() + view(0, 3) * tuple.w(),
+			view(1, 0) * tuple.x() + view(1, 1) * tuple.y() + view(1, 2) * tuple.z() + view(1, 3) * tuple.w(),
+			view(2, 0) * tuple.x() + view(2, 1) * tuple.y() + view(2, 2) * tuple.z() + view(2, 3) * tuple.w(),
+			view(3, 0) * tuple.x() + view(3, 1) * tuple.y() + view(3, 2) * tuple.z() + view(3, 3) * tuple.w());
+	}
+
+	namespace detail
+	{
+		template<bool SUBTRACT, class L, class R>
+		Matrix<typename shape_of<L>::Value, shape_of<L>::ROWS, shape_of<L>::COLS> view_sum(const L& lhs, const R& rhs)
+		{
+			using A = shape_of<L>;
+			using B = shape_of<R>;
+
+			static_assert(std::is_same<typename A::Value, typename B::Value>::value, "Both sides of the sum must hold the same type");
+			static_assert(A::ROWS == B::ROWS && A::COLS == B::COLS, "Matrix has an undefined sum, both sides must have the same shape");
+
+			Matrix<typename A::Value, A::ROWS, A::COLS> result;
+
+			for (int row = 0; row < A::ROWS; ++row)
+			{
+				for (int col = 0; col < A::COLS; ++col)
+				{
+					result(row, col) = SUBTRACT ? lhs(row, col) - rhs(row, col) : lhs(row, col) + rhs(row, col);
+				}
+			}
+
+			return result;
+		}
+	}
+
+	template<class L, class R, typename = std::enable_if_t<detail::either_view<L, R>>>
+	auto operator+(const L& lhs, const R& rhs)
+	{
+		return detail::view_sum<false>(lhs, rhs);
+	}
+
+	template<class L, class R, typename = std::enable_if_t<detail::either_view<L, R>>>
+	auto operator-(const L& lhs, const R& rhs)
+	{
+		return detail::view_sum<true>(lhs, rhs);
+	}
+
+	template<class L, class R, typename = std::enable_if_t<detail::either_view<L, R>>>
+	bool operator==(const L& lhs, const R& rhs)
+	{
+		using A = detail::shape_of<L>;
+		using B = detail::shape_of<R>;
+
+		if constexpr (A::ROWS != B::ROWS || A::COLS != B::COLS)
+		{
+			return false;
+		}
+		else
+		{
+			for (int row = 0; row < A::ROWS; ++row)
+			{
+				for (int col = 0; col < A::COLS; ++col)
+				{
+					if (!equal<typename A::Value>(lhs(row, col), rhs(row, col)))
+					{
+						return false;
+					}
+				}
+			}
+
+			return true;
+		}
+	}
+
+	template<class L, class R, typename = std::enable_if_t<detail::either_view<L, R>>>
+	bool operator!=(const L& lhs, const R& rhs)
+	{
+		return !(lhs == rhs);
+	}
+
+	/// <summary>
+	/// A sequence of x, y, z, w tuples in memory it does not own, one tuple every stride numbers.
+	/// Nothing is copied, so the memory must outlive the span. T is const for a read only span.
+	/// </summary>
+	template<typename T>
+	class Tuple4Span
+	{
+	public:
+		using Value = std::remove_const_t<T>;
+
+		/// <summary>
+		/// Maps a buffer
+		/// </summary>
+		/// <param name="data">The x of the first tuple</param>
+		/// <param name="count">The amount of tuples</param>
+		/// <param name="stride">The amount of numbers from one tuple to the next. At least 4.</param>
+		Tuple4Span(T* data, const std::size_t count, const std::size_t stride = 4)
+			: m_data(data), m_count(count), m_stride(stride)
+		{
+		}
+
+		/// <summary>
+		/// A read only span can be made from a writable one
+		/// </summary>
+		template<typename U, typename = std::enable_if_t<std::is_same<const U, T>::value>>
+		Tuple4Span(const Tuple4Span<U>& other)
+			: m_data(other.data()), m_count(other.size()), m_stride(other.stride())
+		{
+		}
+
+		/// <summary>
+		/// Reads the tuple at index i
+		/// </summary>
+		Tuple4<Value> operator[](const std::size_t i) const
+		{
+			const T* p = m_data + i * m_stride;
+			return Tuple4<Value>(p[0], p[1], p[2], p[3]);
+		}
+
+		/// <summary>
+		/// Writes the tuple at index i
+		/// </summary>
+		void set(const std::size_t i, const Tuple4<Value>& tuple) const
+		{
+			static_assert(!std::is_const<T>::value, "A read only span cannot be written to");
+
+			T* p = m_data + i * m_stride;
+			p[0] = tuple.x();
+			p[1] = tuple.y();
+			p[2] = tuple.z();
+			p[3] = tuple.w();
+		}
+
+		/// <summary>
+		/// Maps count tuples starting at index offset
+		/// </summary>
+		Tuple4Span subspan(const std::size_t offset, const std::size_t count) const
+		{
+			return Tuple4Span(m_data + offset * m_stride, count, m_stride);
+		}
+
+		T* data() const { return m_data; }
+		std::size_t size() const { return m_count; }
+		std::size_t stride() const { return m_stride; }
+	private:
+		T* m_data;
+		std::size_t m_count;
+		std::size_t m_stride;
+	};
+
+	/// <summary>
+	/// A sequence of points stored as x, y, z in memory it does not own, one point every stride numbers.
+	/// The w of every point is 1, and is not stored. Nothing is copied, so the memory must outlive the span.
+	/// T is const for a read only span.
+	/// </summary>
+	template<typename T>
+	class PointSpan
+	{
+	public:
+		using Value = std::remove_const_t<T>;
+
+		/// <summary>
+		/// Maps a buffer
+		/// </summary>
+		/// <param name="data">The x of the first point</param>
+		/// <param name="count">The amount of points</param>
+		/// <param name="stride">The amount of numbers from one point to the next, e.g. the size of an interleaved vertex. At least 3.</param>
+		PointSpan(T* data, const std::size_t count, const std::size_t stride = 3)
+			: m_data(data), m_count(count), m_stride(stride)
+		{
+		}
+
+		/// <summary>
+		/// A read only span can be made from a writable one
+		/// </summary>
+		template<typename U, typename = std::enable_if_t<std::is_same<const U, T>::value>>
+		PointSpan(const PointSpan<U>& other)
+			: m_data(other.data()), m_count(other.size()), m_stride(other.stride())
+		{
+		}
+
+		/// <summary>
+		/// Reads the point at index i, with a w of 1
+		/// </summary>
+		Tuple4<Value> operator[](const std::size_t i) const
+		{
+			const T* p = m_data + i * m_stride;
+			return Tuple4<Value>(p[0], p[1], p[2], 1);
+		}
+
+		/// <summary>
+		/// Writes the x, y and z of the point at index i
+		/// </summary>
+		void set(const std::size_t i, const Tuple4<Value>& point) const
+		{
+			static_assert(!std::is_const<T>::value, "A read only span cannot be written to");
+
+			T* p = m_data + i * m_stride;
+			p[0] = point.x();
+			p[1] = point.y();
+			p[2] = point.z();
+		}
+
+		/// <summary>
+		/// Maps count points starting at index offset
+		/// </summary>
+		PointSpan subspan(const std::size_t offset, const std::size_t count) const
+		{
+			return PointSpan(m_data + offset * m_stride, count, m_stride);
+		}
+
+		T* data() const { return m_data; }
+		std::size_t size() const { return m_count; }
+		std::size_t stride() const { return m_stride; }
+	private:
+		T* m_data;
+		std::size_t m_count;
+		std::size_t m_stride;
+	};
+
+	/// <summary>
+	/// Multiplies every tuple of in by a 4x4 Matrix, writing the results to out. out may map the same memory as in.
+	/// </summary>
+	/// <param name="threads">The most threads to split large spans across. 0 uses every hardware thread.</param>
+	template<typename T, typename U>
+	void apply(const Matrix<T, 4, 4>& matrix, const Tuple4Span<U>& in, const Tuple4Span<T>& out, const unsigned int threads = 1)
+	{
+		static_assert(std::is_same<std::remove_const_t<U>, T>::value, "Both spans must hold the type of the Matrix");
+
+		if (out.size() < in.size())
+		{
+			std::cerr << "Span is too small for the transformed tuples" << std::endl;
+			return;
+		}
+
+		detail::parallel_for(in.size(), threads, [&](std::size_t begin, std::size_t end) {
+			alignas(32) T result[4];
+
+			for (std::size_t i = begin; i < end; ++i)
+			{
+				detail::multiply4x4_tuple(matrix.data(), in.data() + i * in.stride(), result);
+				std::copy_n(result, 4, out.data() + i * out.stride());
+			}
+		});
+	}
+
+	/// <summary>
+	/// Transforms every point of in by an affine 4x4 Matrix, writing the results to out. out may map the same memory as in.
+	/// </summary>
+	/// <param name="threads">The most threads to split large spans across. 0 uses every hardware thread.</param>
+	template<typename T, typename U>
+	void apply(const Matrix<T, 4, 4>& matrix, const PointSpan<U>& in, const PointSpan<T>& out, const unsigned int threads = 1)
+	{
+		static_assert(std::is_same<std::remove_const_t<U>, T>::value, "Both spans must hold the type of the Matrix");
+
+		if (out.size() < in.size())
+		{
+			std::cerr << "Span is too small for the transformed points" << std::endl;
+			return;
+		}
+
+		detail::parallel_for(in.size(), threads, [&](std::size_t begin, std::size_t end) {
+			detail::transform_strided<true>(matrix.data(), in.data() + begin * in.stride(), in.stride(), out.data() + begin * out.stride(), out.stride(), end - begin);
+		});
+	}
+}
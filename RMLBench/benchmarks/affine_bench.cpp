@@ -0,0 +1,225 @@
+#include <benchmark/benchmark.h>
+#include <vector>
+#include "RML.h"
+
+namespace RML
+{
+	static Affine3<double> bench_affine(const double step)
+	{
+		return Affine3<double>(Transform()
+			.translate(step * 0.01, 1, -step * 0.01)
+			.rotate(step, 50, 90)
+			.scale(2, 1, 1.5));
+	}
+
+	template<typename T>
+	static void BM_Matrix_compose(benchmark::State& state)
+	{
+		const Matrix<T, 4, 4> a(bench_affine(30).matrix());
+		const Matrix<T, 4, 4> b(bench_affine(60).matrix());
+
+		for (auto _ : state)
+		{
+			benchmark::DoNotOptimize(a);
+			benchmark::DoNotOptimize(a * b);
+		}
+	}
+	BENCHMARK_TEMPLATE(BM_Matrix_compose, float);
+	BENCHMARK_TEMPLATE(BM_Matrix_compose, double);
+
+	template<typename T>
+	static void BM_Affine3_compose(benchmark::State& state)
+	{
+		const Affine3<T> a(Matrix<T, 4, 4>(bench_affine(30).matrix()));
+		const Affine3<T> b(Matrix<T, 4, 4>(bench_affine(60).matrix()));
+
+		for (auto _ : state)
+		{
+			benchmark::DoNotOptimize(a);
+			benchmark::DoNotOptimize(a * b);
+		}
+	}
+	BENCHMARK_TEMPLATE(BM_Affine3_compose, float);
+	BENCHMARK_TEMPLATE(BM_Affine3_compose, double);
+
+	static void BM_Affine3_inverse(benchmark::State& state)
+	{
+		const Affine3<double> affine = bench_affine(30);
+
+		for (auto _ : state)
+		{
+			benchmark::DoNotOptimize(affine);
+			benchmark::DoNotOptimize(affine.inverse());
+		}
+	}
+	BENCHMARK(BM_Affine3_inverse);
+
+	static void BM_Matrix_trs_dense(benchmark::State& state)
+	{
+		const Matrix<double, 4, 4> translation = TranslationMatrix<double>(1, 2, 3).matrix();
+		const Matrix<double, 4, 4> rotation = Quaternion::euler_angles(30, 45, 60).matrix();
+		const Matrix<double, 4, 4> scale = ScaleMatrix<double>(2, 3, 4).matrix();
+
+		for (auto _ : state)
+		{
+			benchmark::DoNotOptimize(translation);
+			benchmark::DoNotOptimize(translation * rotation * scale);
+		}
+	}
+	BENCHMARK(BM_Matrix_trs_dense);
+
+	static void BM_Matrix_trs_structured(benchmark::State& state)
+	{
+		const TranslationMatrix<double> translation(1, 2, 3);
+		const RotationMatrix3<double> rotation(Quaternion::euler_angles(30, 45, 60));
+		const ScaleMatrix<double> scale(2, 3, 4);
+
+		for (auto _ : state)
+		{
+			benchmark::DoNotOptimize(translation);
+			benchmark::DoNotOptimize((translation * rotation * scale).matrix());
+		}
+	}
+	BENCHMARK(BM_Matrix_trs_structured);
+
+	static void BM_Matrix_scale_rows(benchmark::State& state)
+	{
+		const Matrix<double, 4, 4> matrix = bench_affine(30).matrix();
+		const ScaleMatrix<double> scale(2, 3, 4);
+
+		for (auto _ : state)
+		{
+			benchmark::DoNotOptimize(matrix);
+			benchmark::DoNotOptimize(scale * matrix);
+		}
+	}
+	BENCHMARK(BM_Matrix_scale_rows);
+
+	// Macro benchmarks
+
+	constexpr std::size_t TRANSFORM_COUNT = 100000;
+
+	// Places every local transform under one parent, as when updating the world transforms of a scene graph.
+	// The transforms do not fit in cache, so the memory they take shows up in the timing.
+	static void BM_Matrix_parent_100k(benchmark::State& state)
+	{
+		const Matrix<double, 4, 4> parent = bench_affine(45).matrix();
+		std::vector<Matrix<double, 4, 4>> local;
+
+		for (std::size_t i = 0; i < TRANSFORM_COUNT; ++i)
+		{
+			local.push_back(bench_affine(static_cast<double>(i % 360)).matrix());
+		}
+
+		std::vector<Matrix<double, 4, 4>> world(local.size());
+
+		for (auto _ : state)
+		{
+			for (std::size_t i = 0; i < local.size(); ++i)
+			{
+				world[i] = parent * local[i];
+			}
+
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * local.size());
+		state.SetBytesProcessed(state.iterations() * local.size() * sizeof(Matrix<double, 4, 4>) * 2);
+	}
+	BENCHMARK(BM_Matrix_parent_100k)->Unit(benchmark::kMillisecond);
+
+	static void BM_Affine3_parent_100k(benchmark::State& state)
+	{
+		const Affine3<double> parent = bench_affine(45);
+		std::vector<Affine3<double>> local;
+
+		for (std::size_t i = 0; i < TRANSFORM_COUNT; ++i)
+		{
+			local.push_back(bench_affine(static_cast<double>(i % 360)));
+		}
+
+		std::vector<Affine3<double>> world(local.size());
+
+		for (auto _ : state)
+		{
+			for (std::size_t i = 0; i < local.size(); ++i)
+			{
+				world[i] = parent * local[i];
+			}
+
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * local.size());
+		state.SetBytesProcessed(state.iterations() * local.size() * sizeof(Affine3<double>) * 2);
+	}
+	BENCHMARK(BM_Affine3_parent_100k)->Unit(benchmark::kMillisecond);
+
+	// Transforms a point cloud that does not fit in cache, stored as 32 byte Points or as 3 component Point3s
+	static void BM_Point_cloud_100k(benchmark::State& state)
+	{
+		const Affine3<double> affine = bench_affine(45);
+		std::vector<Point> points;
+
+		for (std::size_t i = 0; i < TRANSFORM_COUNT; ++i)
+		{
+			points.emplace_back(static_cast<double>(i), 1, -static_cast<double>(i));
+		}
+
+		for (auto _ : state)
+		{
+			affine.apply(points.data(), points.data(), points.size());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * points.size());
+		state.SetBytesProcessed(state.iterations() * points.size() * sizeof(Point) * 2);
+	}
+	BENCHMARK(BM_Point_cloud_100k)->Unit(benchmark::kMicrosecond);
+
+	template<typename T>
+	static void BM_Point3_cloud_100k(benchmark::State& state)
+	{
+		const Affine3<T> affine(Matrix<T, 4, 4>(bench_affine(45).matrix()));
+		std::vector<Point3<T>> points;
+
+		for (std::size_t i = 0; i < TRANSFORM_COUNT; ++i)
+		{
+			points.emplace_back(static_cast<T>(i), static_cast<T>(1), -static_cast<T>(i));
+		}
+
+		for (auto _ : state)
+		{
+			affine.apply(points.data(), points.data(), points.size());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * points.size());
+		state.SetBytesProcessed(state.iterations() * points.size() * sizeof(Point3<T>) * 2);
+	}
+	BENCHMARK_TEMPLATE(BM_Point3_cloud_100k, float)->Unit(benchmark::kMicrosecond);
+	BENCHMARK_TEMPLATE(BM_Point3_cloud_100k, double)->Unit(benchmark::kMicrosecond);
+
+	template<typename T>
+	static void BM_PointArray_cloud_100k(benchmark::State& state)
+	{
+		const Affine3<T> affine(Matrix<T, 4, 4>(bench_affine(45).matrix()));
+		PointArray<T> points;
+
+		for (std::size_t i = 0; i < TRANSFORM_COUNT; ++i)
+		{
+			points.push_back(Point3<T>(static_cast<T>(i), static_cast<T>(1), -static_cast<T>(i)));
+		}
+
+		for (auto _ : state)
+		{
+			points.apply(affine);
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * points.size());
+		state.SetBytesProcessed(state.iterations() * points.size() * sizeof(T) * 3 * 2);
+	}
+	BENCHMARK_TEMPLATE(BM_PointArray_cloud_100k, float)->Unit(benchmark::kMicrosecond);
+	BENCHMARK_TEMPLATE(BM_PointArray_cloud_100k, double)->Unit(benchmark::kMicrosecond);
+}
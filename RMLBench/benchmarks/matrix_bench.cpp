@@ -0,0 +1,342 @@
+#include <benchmark/benchmark.h>
+#include "RML.h"
+
+namespace RML
+{
+	static const std::array<double, 16> INVERTIBLE_4x4 = {
+		-5, 2, 6, -8,
+		1, -5, 1, 8,
+		7, 7, -6, -7,
+		1, -3, 7, 4
+	};
+
+	template<typename T>
+	static Matrix<T, 4, 4> invertible_4x4()
+	{
+		return Matrix<double, 4, 4>(INVERTIBLE_4x4);
+	}
+
+	template<typename T>
+	static void BM_Matrix_multiply_4x4(benchmark::State& state)
+	{
+		Matrix<T, 4, 4> a = invertible_4x4<T>();
+		Matrix<T, 4, 4> b = a.transpose();
+
+		for (auto _ : state)
+		{
+			benchmark::DoNotOptimize(a);
+			benchmark::DoNotOptimize(a * b);
+		}
+	}
+	BENCHMARK_TEMPLATE(BM_Matrix_multiply_4x4, float);
+	BENCHMARK_TEMPLATE(BM_Matrix_multiply_4x4, double);
+
+	template<typename T>
+	static void BM_Matrix_multiply_tuple(benchmark::State& state)
+	{
+		Matrix<T, 4, 4> matrix = invertible_4x4<T>();
+		Tuple4<T> tuple(1, 2, 3, 1);
+
+		for (auto _ : state)
+		{
+			benchmark::DoNotOptimize(tuple);
+			benchmark::DoNotOptimize(matrix * tuple);
+		}
+	}
+	BENCHMARK_TEMPLATE(BM_Matrix_multiply_tuple, float);
+	BENCHMARK_TEMPLATE(BM_Matrix_multiply_tuple, double);
+
+	template<typename T>
+	static void BM_ColMajorMatrix_multiply_4x4(benchmark::State& state)
+	{
+		ColMajorMatrix<T, 4, 4> a = invertible_4x4<T>();
+		ColMajorMatrix<T, 4, 4> b = a.transpose();
+
+		for (auto _ : state)
+		{
+			benchmark::DoNotOptimize(a);
+			benchmark::DoNotOptimize(a * b);
+		}
+	}
+	BENCHMARK_TEMPLATE(BM_ColMajorMatrix_multiply_4x4, float);
+	BENCHMARK_TEMPLATE(BM_ColMajorMatrix_multiply_4x4, double);
+
+	template<typename T>
+	static void BM_ColMajorMatrix_multiply_tuple(benchmark::State& state)
+	{
+		ColMajorMatrix<T, 4, 4> matrix = invertible_4x4<T>();
+		Tuple4<T> tuple(1, 2, 3, 1);
+
+		for (auto _ : state)
+		{
+			benchmark::DoNotOptimize(tuple);
+			benchmark::DoNotOptimize(matrix * tuple);
+		}
+	}
+	BENCHMARK_TEMPLATE(BM_ColMajorMatrix_multiply_tuple, float);
+	BENCHMARK_TEMPLATE(BM_ColMajorMatrix_multiply_tuple, double);
+
+	// A row-major product transposed for a column-major graphics API, against the column-major product used directly
+	template<typename T>
+	static void BM_Matrix_multiply_for_upload(benchmark::State& state)
+	{
+		Matrix<T, 4, 4> a = invertible_4x4<T>();
+		Matrix<T, 4, 4> b = a.transpose();
+
+		for (auto _ : state)
+		{
+			benchmark::DoNotOptimize(a);
+			benchmark::DoNotOptimize((a * b).transpose());
+		}
+	}
+	BENCHMARK_TEMPLATE(BM_Matrix_multiply_for_upload, float);
+
+	template<typename T>
+	static void BM_Matrix_transpose_4x4(benchmark::State& state)
+	{
+		Matrix<T, 4, 4> matrix = invertible_4x4<T>();
+
+		for (auto _ : state)
+		{
+			benchmark::DoNotOptimize(matrix);
+			benchmark::DoNotOptimize(matrix.transpose());
+		}
+	}
+	BENCHMARK_TEMPLATE(BM_Matrix_transpose_4x4, float);
+	BENCHMARK_TEMPLATE(BM_Matrix_transpose_4x4, double);
+
+	template<typename T>
+	static void BM_Matrix_invert_4x4(benchmark::State& state)
+	{
+		Matrix<T, 4, 4> matrix = invertible_4x4<T>();
+
+		for (auto _ : state)
+		{
+			benchmark::DoNotOptimize(matrix);
+			benchmark::DoNotOptimize(matrix.invert());
+		}
+	}
+	BENCHMARK_TEMPLATE(BM_Matrix_invert_4x4, float);
+	BENCHMARK_TEMPLATE(BM_Matrix_invert_4x4, double);
+
+	// The cofactor expansion used for every size before the closed form inverse
+	static void BM_Matrix_invert_4x4_cofactor(benchmark::State& state)
+	{
+		for (auto _ : state)
+		{
+			Matrix<double, 4, 4> matrix(INVERTIBLE_4x4);
+			Matrix<double, 4, 4> result;
+
+			const double determinant = matrix.determinant();
+
+			for (int row = 0; row < 4; ++row)
+			{
+				for (int col = 0; col < 4; ++col)
+				{
+					result(col, row) = matrix.cofactor(row, col) / determinant;
+				}
+			}
+
+			benchmark::DoNotOptimize(result);
+		}
+	}
+	BENCHMARK(BM_Matrix_invert_4x4_cofactor);
+
+	template<typename T>
+	static void BM_Matrix_affine_inverse(benchmark::State& state)
+	{
+		Matrix<T, 4, 4> matrix = invertible_4x4<T>();
+
+		for (int col = 0; col < 3; ++col)
+		{
+			matrix(3, col) = 0;
+		}
+
+		matrix(3, 3) = 1;
+
+		for (auto _ : state)
+		{
+			benchmark::DoNotOptimize(matrix);
+			benchmark::DoNotOptimize(matrix.affine_inverse());
+		}
+	}
+	BENCHMARK_TEMPLATE(BM_Matrix_affine_inverse, float);
+	BENCHMARK_TEMPLATE(BM_Matrix_affine_inverse, double);
+
+	template<typename T>
+	static void BM_Matrix_determinant_4x4(benchmark::State& state)
+	{
+		Matrix<T, 4, 4> matrix = invertible_4x4<T>();
+
+		for (auto _ : state)
+		{
+			benchmark::DoNotOptimize(matrix);
+			benchmark::DoNotOptimize(matrix.determinant());
+		}
+	}
+	BENCHMARK_TEMPLATE(BM_Matrix_determinant_4x4, float);
+	BENCHMARK_TEMPLATE(BM_Matrix_determinant_4x4, double);
+
+	template<int N>
+	static void BM_Matrix_invert_LU(benchmark::State& state)
+	{
+		Matrix<double, N, N> matrix;
+
+		for (int row = 0; row < N; ++row)
+		{
+			for (int col = 0; col < N; ++col)
+			{
+				matrix(row, col) = row == col ? N : ((row * 7 + col * 3) % 5) - 2.0;
+			}
+		}
+
+		for (auto _ : state)
+		{
+			LU<double, N> lu(matrix);
+			benchmark::DoNotOptimize(lu.inverse());
+		}
+	}
+	BENCHMARK_TEMPLATE(BM_Matrix_invert_LU, 6);
+	BENCHMARK_TEMPLATE(BM_Matrix_invert_LU, 12);
+
+	// view * model * position as written, which multiplies the two 4x4 matrices first
+	static void BM_Matrix_chain_eager(benchmark::State& state)
+	{
+		Matrix<double, 4, 4> view = invertible_4x4<double>();
+		Matrix<double, 4, 4> model = view.transpose();
+		Matrix<double, 4, 1> position({ 1, 2, 3, 1 });
+
+		for (auto _ : state)
+		{
+			benchmark::DoNotOptimize(view);
+			Matrix<double, 4, 1> result = view * model * position;
+			benchmark::DoNotOptimize(result);
+		}
+	}
+	BENCHMARK(BM_Matrix_chain_eager);
+
+	// The same chain as an expression, which multiplies position through each Matrix instead
+	static void BM_Matrix_chain_lazy(benchmark::State& state)
+	{
+		Matrix<double, 4, 4> view = invertible_4x4<double>();
+		Matrix<double, 4, 4> model = view.transpose();
+		Matrix<double, 4, 1> position({ 1, 2, 3, 1 });
+
+		for (auto _ : state)
+		{
+			benchmark::DoNotOptimize(view);
+			Matrix<double, 4, 1> result = expr::lazy(view) * model * position;
+			benchmark::DoNotOptimize(result);
+		}
+	}
+	BENCHMARK(BM_Matrix_chain_lazy);
+
+	template<int N>
+	static Matrix<double, N, N> numbered_square()
+	{
+		Matrix<double, N, N> matrix;
+
+		for (int row = 0; row < N; ++row)
+		{
+			for (int col = 0; col < N; ++col)
+			{
+				matrix(row, col) = ((row * 7 + col * 3) % 5) - 2.0;
+			}
+		}
+
+		return matrix;
+	}
+
+	// The plain row-column loop, for comparison with the blocked product
+	template<int N>
+	static void BM_Matrix_product_naive(benchmark::State& state)
+	{
+		const Matrix<double, N, N> lhs = numbered_square<N>();
+		const Matrix<double, N, N> rhs = lhs.transpose();
+
+		for (auto _ : state)
+		{
+			Matrix<double, N, N> result;
+
+			for (int row = 0; row < N; ++row)
+			{
+				for (int col = 0; col < N; ++col)
+				{
+					double value = 0;
+
+					for (int i = 0; i < N; ++i)
+					{
+						value += lhs(row, i) * rhs(i, col);
+					}
+
+					result(row, col) = value;
+				}
+			}
+
+			benchmark::DoNotOptimize(result);
+		}
+	}
+	BENCHMARK_TEMPLATE(BM_Matrix_product_naive, 64);
+	BENCHMARK_TEMPLATE(BM_Matrix_product_naive, 128);
+	BENCHMARK_TEMPLATE(BM_Matrix_product_naive, 256);
+	BENCHMARK_TEMPLATE(BM_Matrix_product_naive, 512);
+
+	// The blocked product, with state.range(0) threads. 0 uses every hardware thread.
+	template<int N>
+	static void BM_Matrix_product_blocked(benchmark::State& state)
+	{
+		const Matrix<double, N, N> lhs = numbered_square<N>();
+		const Matrix<double, N, N> rhs = lhs.transpose();
+		const unsigned int threads = static_cast<unsigned int>(state.range(0));
+
+		for (auto _ : state)
+		{
+			benchmark::DoNotOptimize(lhs.multiply(rhs, threads));
+		}
+	}
+	BENCHMARK_TEMPLATE(BM_Matrix_product_blocked, 64)->Arg(1)->Arg(0);
+	BENCHMARK_TEMPLATE(BM_Matrix_product_blocked, 128)->Arg(1)->Arg(0);
+	BENCHMARK_TEMPLATE(BM_Matrix_product_blocked, 256)->Arg(1)->Arg(0);
+	BENCHMARK_TEMPLATE(BM_Matrix_product_blocked, 512)->Arg(1)->Arg(0)->UseRealTime();
+
+	// DynamicMatrix with the sizes of BM_Matrix_invert_LU, to compare the cost of runtime sizes
+	static void BM_DynamicMatrix_invert(benchmark::State& state)
+	{
+		const int n = static_cast<int>(state.range(0));
+		DynamicMatrix<double> matrix(n, n);
+
+		for (int row = 0; row < n; ++row)
+		{
+			for (int col = 0; col < n; ++col)
+			{
+				matrix(row, col) = row == col ? n : ((row * 7 + col * 3) % 5) - 2.0;
+			}
+		}
+
+		for (auto _ : state)
+		{
+			benchmark::DoNotOptimize(matrix.invert());
+		}
+	}
+	BENCHMARK(BM_DynamicMatrix_invert)->Arg(6)->Arg(12)->Arg(64);
+
+	static void BM_DynamicMatrix_product(benchmark::State& state)
+	{
+		const int n = static_cast<int>(state.range(0));
+		DynamicMatrix<double> matrix(n, n);
+
+		for (int row = 0; row < n; ++row)
+		{
+			for (int col = 0; col < n; ++col)
+			{
+				matrix(row, col) = ((row * 7 + col * 3) % 5) - 2.0;
+			}
+		}
+
+		for (auto _ : state)
+		{
+			benchmark::DoNotOptimize(matrix * matrix);
+		}
+	}
+	BENCHMARK(BM_DynamicMatrix_product)->Arg(16)->Arg(64)->Arg(256);
+}
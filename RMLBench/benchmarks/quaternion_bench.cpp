@@ -0,0 +1,67 @@
+#include <benchmark/benchmark.h>
+#include "RML.h"
+
+namespace RML
+{
+	static void BM_Quaternion_multiply(benchmark::State& state)
+	{
+		Quaternion a = Quaternion::euler_angles(30, 45, 60);
+		Quaternion b = Quaternion::euler_angles(-10, 80, 15);
+
+		for (auto _ : state)
+		{
+			benchmark::DoNotOptimize(a);
+			benchmark::DoNotOptimize(a * b);
+		}
+	}
+	BENCHMARK(BM_Quaternion_multiply);
+
+	static void BM_Quaternion_rotate(benchmark::State& state)
+	{
+		Quaternion rotation = Quaternion::euler_angles(30, 45, 60);
+		Vector vector(1, 2, 3);
+
+		for (auto _ : state)
+		{
+			benchmark::DoNotOptimize(vector);
+			benchmark::DoNotOptimize(rotation * vector);
+		}
+	}
+	BENCHMARK(BM_Quaternion_rotate);
+
+	static void BM_Quaternion_matrix(benchmark::State& state)
+	{
+		Quaternion rotation = Quaternion::euler_angles(30, 45, 60);
+
+		for (auto _ : state)
+		{
+			benchmark::DoNotOptimize(rotation);
+			benchmark::DoNotOptimize(rotation.matrix());
+		}
+	}
+	BENCHMARK(BM_Quaternion_matrix);
+
+	static void BM_Quaternion_euler_angles(benchmark::State& state)
+	{
+		double x = 30, y = 45, z = 60;
+
+		for (auto _ : state)
+		{
+			benchmark::DoNotOptimize(x);
+			benchmark::DoNotOptimize(Quaternion::euler_angles(x, y, z));
+		}
+	}
+	BENCHMARK(BM_Quaternion_euler_angles);
+
+	static void BM_Quaternion_to_euler(benchmark::State& state)
+	{
+		Quaternion rotation = Quaternion::euler_angles(30, 45, 60);
+
+		for (auto _ : state)
+		{
+			benchmark::DoNotOptimize(rotation);
+			benchmark::DoNotOptimize(rotation.to_euler());
+		}
+	}
+	BENCHMARK(BM_Quaternion_to_euler);
+}
@@ -0,0 +1,144 @@
+#include <benchmark/benchmark.h>
+#include <vector>
+#include "RML.h"
+
+namespace RML
+{
+	static Transform bench_transform()
+	{
+		return Transform()
+			.translate(10, 5, -5)
+			.rotate(120, 50, 90)
+			.scale(10, 5, 1.2);
+	}
+
+	static void BM_Transform_matrix(benchmark::State& state)
+	{
+		Transform transform = bench_transform();
+
+		for (auto _ : state)
+		{
+			// Moving the Transform clears its cached matrix, so every iteration rebuilds it
+			transform.translate(0, 0, 0);
+			benchmark::DoNotOptimize(transform.matrix());
+		}
+	}
+	BENCHMARK(BM_Transform_matrix);
+
+	static void BM_Transform_get_inverted(benchmark::State& state)
+	{
+		Transform transform = bench_transform();
+
+		for (auto _ : state)
+		{
+			transform.translate(0, 0, 0);
+			benchmark::DoNotOptimize(transform.get_inverted());
+		}
+	}
+	BENCHMARK(BM_Transform_get_inverted);
+
+	static void BM_Transform_multiply_point(benchmark::State& state)
+	{
+		Transform transform = bench_transform();
+		Point point(1, 2, 3);
+
+		for (auto _ : state)
+		{
+			benchmark::DoNotOptimize(point);
+			benchmark::DoNotOptimize(transform * point);
+		}
+	}
+	BENCHMARK(BM_Transform_multiply_point);
+
+	static void BM_Transform_multiply_vector(benchmark::State& state)
+	{
+		Transform transform = bench_transform();
+		Vector vector(1, 2, 3);
+
+		for (auto _ : state)
+		{
+			benchmark::DoNotOptimize(vector);
+			benchmark::DoNotOptimize(transform * vector);
+		}
+	}
+	BENCHMARK(BM_Transform_multiply_vector);
+
+	// Macro benchmarks
+
+	constexpr std::size_t POINT_COUNT = 1000000;
+	constexpr int COMPOSE_COUNT = 100000;
+
+	static std::vector<Point> bench_points()
+	{
+		std::vector<Point> points;
+		points.reserve(POINT_COUNT);
+
+		for (std::size_t i = 0; i < POINT_COUNT; ++i)
+		{
+			points.emplace_back(i % 101, i % 37, i % 53);
+		}
+
+		return points;
+	}
+
+	static void BM_Transform_1M_points(benchmark::State& state)
+	{
+		Transform transform = bench_transform();
+		std::vector<Point> points = bench_points();
+		std::vector<Point> result(points.size());
+
+		for (auto _ : state)
+		{
+			for (std::size_t i = 0; i < points.size(); ++i)
+			{
+				result[i] = transform * points[i];
+			}
+
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * points.size());
+	}
+	BENCHMARK(BM_Transform_1M_points)->Unit(benchmark::kMillisecond);
+
+	static void BM_Transform_apply_1M_points(benchmark::State& state)
+	{
+		Transform transform = bench_transform();
+		std::vector<Point> points = bench_points();
+		std::vector<Point> result(points.size());
+
+		for (auto _ : state)
+		{
+			transform.apply(points.data(), result.data(), points.size(), static_cast<unsigned int>(state.range(0)));
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * points.size());
+	}
+	BENCHMARK(BM_Transform_apply_1M_points)->Arg(1)->Arg(0)->Unit(benchmark::kMillisecond);
+
+	static void BM_Transform_compose_100k(benchmark::State& state)
+	{
+		for (auto _ : state)
+		{
+			Matrix<double, 4, 4> result = Matrix<double, 4, 4>::identity();
+
+			for (int i = 0; i < COMPOSE_COUNT; ++i)
+			{
+				const double step = i % 360;
+
+				Transform transform = Transform()
+					.translate(step * 0.01, 0, -step * 0.01)
+					.rotate(step, 0, 0)
+					.scale(1, 1, 1);
+
+				result = result * transform.matrix();
+			}
+
+			benchmark::DoNotOptimize(result);
+		}
+
+		state.SetItemsProcessed(state.iterations() * COMPOSE_COUNT);
+	}
+	BENCHMARK(BM_Transform_compose_100k)->Unit(benchmark::kMillisecond);
+}
@@ -0,0 +1,427 @@
+#include <benchmark/benchmark.h>
+#include <vector>
+#include "RML.h"
+
+namespace RML
+{
+	static void BM_Vector_normalized(benchmark::State& state)
+	{
+		Vector vector(1, 2, 3);
+
+		for (auto _ : state)
+		{
+			benchmark::DoNotOptimize(vector);
+			benchmark::DoNotOptimize(vector.normalized());
+		}
+	}
+	BENCHMARK(BM_Vector_normalized);
+
+	static void BM_Vector_cross(benchmark::State& state)
+	{
+		Vector a(1, 2, 3);
+		Vector b(-4, 5, 0.5);
+
+		for (auto _ : state)
+		{
+			benchmark::DoNotOptimize(a);
+			benchmark::DoNotOptimize(Vector::cross(a, b));
+		}
+	}
+	BENCHMARK(BM_Vector_cross);
+
+	static void BM_Vector_dot(benchmark::State& state)
+	{
+		Vector a(1, 2, 3);
+		Vector b(-4, 5, 0.5);
+
+		for (auto _ : state)
+		{
+			benchmark::DoNotOptimize(a);
+			benchmark::DoNotOptimize(Vector::dot(a, b));
+		}
+	}
+	BENCHMARK(BM_Vector_dot);
+
+	static void BM_Vector_angle(benchmark::State& state)
+	{
+		Vector a(1, 2, 3);
+		Vector b(-4, 5, 0.5);
+
+		for (auto _ : state)
+		{
+			benchmark::DoNotOptimize(a);
+			benchmark::DoNotOptimize(Vector::angle(a, b));
+		}
+	}
+	BENCHMARK(BM_Vector_angle);
+
+	// Vector::dot is defined in the header, so this loop can be vectorized in either build mode.
+	// Compare with the same loop over plain arrays to check that it was.
+	static void BM_Vector_dot_array(benchmark::State& state)
+	{
+		const std::size_t count = static_cast<std::size_t>(state.range(0));
+
+		std::vector<Vector> a(count, Vector(1, 2, 3));
+		std::vector<Vector> b(count, Vector(-4, 5, 0.5));
+		std::vector<double> result(count);
+
+		for (auto _ : state)
+		{
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				result[i] = Vector::dot(a[i], b[i]);
+			}
+
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * count);
+	}
+	BENCHMARK(BM_Vector_dot_array)->Arg(1024)->Arg(65536);
+
+	static void BM_Vector_dot_array_baseline(benchmark::State& state)
+	{
+		const std::size_t count = static_cast<std::size_t>(state.range(0));
+
+		std::vector<double> a(count * 4, 1);
+		std::vector<double> b(count * 4, 2);
+		std::vector<double> result(count);
+
+		for (auto _ : state)
+		{
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				const double* x = &a[i * 4];
+				const double* y = &b[i * 4];
+
+				result[i] = x[0] * y[0] + x[1] * y[1] + x[2] * y[2];
+			}
+
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * count);
+	}
+	BENCHMARK(BM_Vector_dot_array_baseline)->Arg(1024)->Arg(65536);
+
+	// Vector::magnitude is only visible to this loop in the header only build
+	static void BM_Vector_magnitude_array(benchmark::State& state)
+	{
+		const std::size_t count = static_cast<std::size_t>(state.range(0));
+
+		std::vector<Vector> vectors(count, Vector(1, 2, 3));
+		std::vector<double> result(count);
+
+		for (auto _ : state)
+		{
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				result[i] = vectors[i].magnitude();
+			}
+
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * count);
+	}
+	BENCHMARK(BM_Vector_magnitude_array)->Arg(1024)->Arg(65536);
+
+	// Moves every point along its velocity, as when stepping a particle system
+	template<typename T>
+	static void BM_Tuple4_step_array(benchmark::State& state)
+	{
+		const std::size_t count = static_cast<std::size_t>(state.range(0));
+
+		std::vector<Tuple4<T>> positions(count, Tuple4<T>(1, 2, 3, 1));
+		std::vector<Tuple4<T>> velocities(count, Tuple4<T>(-4, 5, static_cast<T>(0.5), 0));
+		const T step = static_cast<T>(0.01);
+
+		for (auto _ : state)
+		{
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				positions[i] += velocities[i] * step;
+			}
+
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * count);
+	}
+	BENCHMARK_TEMPLATE(BM_Tuple4_step_array, float)->Arg(1024);
+	BENCHMARK_TEMPLATE(BM_Tuple4_step_array, double)->Arg(1024);
+
+	template<typename T>
+	static void BM_Tuple4_clamp(benchmark::State& state)
+	{
+		Tuple4<T> tuple(-4, 5, static_cast<T>(0.5), 1);
+		const Tuple4<T> low(-1, -1, -1, 0);
+		const Tuple4<T> high(1, 1, 1, 1);
+
+		for (auto _ : state)
+		{
+			benchmark::DoNotOptimize(tuple);
+			benchmark::DoNotOptimize(Tuple4<T>::min(Tuple4<T>::max(tuple, low), high));
+		}
+	}
+	BENCHMARK_TEMPLATE(BM_Tuple4_clamp, float);
+	BENCHMARK_TEMPLATE(BM_Tuple4_clamp, double);
+
+	template<typename T>
+	static void BM_Tuple4_equality(benchmark::State& state)
+	{
+		const Tuple4<T> a(-4, 5, static_cast<T>(0.5), 1);
+		const Tuple4<T> b(-4, 5, static_cast<T>(0.5), 1);
+
+		for (auto _ : state)
+		{
+			benchmark::DoNotOptimize(a);
+			benchmark::DoNotOptimize(a == b);
+		}
+	}
+	BENCHMARK_TEMPLATE(BM_Tuple4_equality, float);
+	BENCHMARK_TEMPLATE(BM_Tuple4_equality, double);
+
+	template<typename T>
+	static void BM_Tuple3_step_array(benchmark::State& state)
+	{
+		const std::size_t count = static_cast<std::size_t>(state.range(0));
+
+		std::vector<Tuple3<T>> positions(count, Tuple3<T>(1, 2, 3));
+		std::vector<Tuple3<T>> velocities(count, Tuple3<T>(-4, 5, static_cast<T>(0.5)));
+		const T step = static_cast<T>(0.01);
+
+		for (auto _ : state)
+		{
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				positions[i] += velocities[i] * step;
+			}
+
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * count);
+	}
+	BENCHMARK_TEMPLATE(BM_Tuple3_step_array, float)->Arg(1024);
+	BENCHMARK_TEMPLATE(BM_Tuple3_step_array, double)->Arg(1024);
+
+	template<typename T>
+	static void BM_Tuple3_equality(benchmark::State& state)
+	{
+		const Tuple3<T> a(-4, 5, static_cast<T>(0.5));
+		const Tuple3<T> b(-4, 5, static_cast<T>(0.5));
+
+		for (auto _ : state)
+		{
+			benchmark::DoNotOptimize(a);
+			benchmark::DoNotOptimize(a == b);
+		}
+	}
+	BENCHMARK_TEMPLATE(BM_Tuple3_equality, float);
+	BENCHMARK_TEMPLATE(BM_Tuple3_equality, double);
+
+	template<typename T>
+	static std::vector<Vector3<T>> bench_vector3s(const std::size_t count)
+	{
+		std::vector<Vector3<T>> vectors;
+
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			vectors.emplace_back(static_cast<T>(i + 1), static_cast<T>(i % 7) - 3, static_cast<T>(0.5));
+		}
+
+		return vectors;
+	}
+
+	// The same bulk operations on an array of Vector3s and on a VectorArray, which keeps x, y and z in separate arrays
+	template<typename T>
+	static void BM_Vector3_normalize_array(benchmark::State& state)
+	{
+		std::vector<Vector3<T>> vectors = bench_vector3s<T>(static_cast<std::size_t>(state.range(0)));
+
+		for (auto _ : state)
+		{
+			for (Vector3<T>& vector : vectors)
+			{
+				vector = vector.normalized();
+			}
+
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * vectors.size());
+	}
+	BENCHMARK_TEMPLATE(BM_Vector3_normalize_array, float)->Arg(4096);
+	BENCHMARK_TEMPLATE(BM_Vector3_normalize_array, double)->Arg(4096);
+
+	template<typename T>
+	static void BM_VectorArray_normalize(benchmark::State& state)
+	{
+		const std::vector<Vector3<T>> aos = bench_vector3s<T>(static_cast<std::size_t>(state.range(0)));
+		VectorArray<T> vectors;
+
+		for (const Vector3<T>& vector : aos)
+		{
+			vectors.push_back(vector);
+		}
+
+		for (auto _ : state)
+		{
+			vectors.normalize();
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * vectors.size());
+	}
+	BENCHMARK_TEMPLATE(BM_VectorArray_normalize, float)->Arg(4096);
+	BENCHMARK_TEMPLATE(BM_VectorArray_normalize, double)->Arg(4096);
+
+	template<typename T>
+	static void BM_Vector3_dot_array(benchmark::State& state)
+	{
+		const std::vector<Vector3<T>> a = bench_vector3s<T>(static_cast<std::size_t>(state.range(0)));
+		const std::vector<Vector3<T>> b(a.rbegin(), a.rend());
+		std::vector<T> dots(a.size());
+
+		for (auto _ : state)
+		{
+			for (std::size_t i = 0; i < a.size(); ++i)
+			{
+				dots[i] = Vector3<T>::dot(a[i], b[i]);
+			}
+
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * a.size());
+	}
+	BENCHMARK_TEMPLATE(BM_Vector3_dot_array, float)->Arg(4096);
+	BENCHMARK_TEMPLATE(BM_Vector3_dot_array, double)->Arg(4096);
+
+	template<typename T>
+	static void BM_VectorArray_dot(benchmark::State& state)
+	{
+		const std::vector<Vector3<T>> aos = bench_vector3s<T>(static_cast<std::size_t>(state.range(0)));
+		VectorArray<T> a;
+		VectorArray<T> b;
+
+		for (std::size_t i = 0; i < aos.size(); ++i)
+		{
+			a.push_back(aos[i]);
+			b.push_back(aos[aos.size() - 1 - i]);
+		}
+
+		std::vector<T> dots(a.size());
+
+		for (auto _ : state)
+		{
+			VectorArray<T>::dot(a, b, dots.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * a.size());
+	}
+	BENCHMARK_TEMPLATE(BM_VectorArray_dot, float)->Arg(4096);
+	BENCHMARK_TEMPLATE(BM_VectorArray_dot, double)->Arg(4096);
+
+	template<typename T>
+	static void BM_Vector3_sum_array(benchmark::State& state)
+	{
+		const std::vector<Vector3<T>> vectors = bench_vector3s<T>(static_cast<std::size_t>(state.range(0)));
+
+		for (auto _ : state)
+		{
+			Vector3<T> sum;
+
+			for (const Vector3<T>& vector : vectors)
+			{
+				sum += vector;
+			}
+
+			benchmark::DoNotOptimize(sum);
+		}
+
+		state.SetItemsProcessed(state.iterations() * vectors.size());
+	}
+	BENCHMARK_TEMPLATE(BM_Vector3_sum_array, float)->Arg(4096);
+	BENCHMARK_TEMPLATE(BM_Vector3_sum_array, double)->Arg(4096);
+
+	template<typename T>
+	static void BM_VectorArray_sum(benchmark::State& state)
+	{
+		const std::vector<Vector3<T>> aos = bench_vector3s<T>(static_cast<std::size_t>(state.range(0)));
+		VectorArray<T> vectors;
+
+		for (const Vector3<T>& vector : aos)
+		{
+			vectors.push_back(vector);
+		}
+
+		for (auto _ : state)
+		{
+			benchmark::DoNotOptimize(vectors.sum());
+		}
+
+		state.SetItemsProcessed(state.iterations() * vectors.size());
+	}
+	BENCHMARK_TEMPLATE(BM_VectorArray_sum, float)->Arg(4096);
+	BENCHMARK_TEMPLATE(BM_VectorArray_sum, double)->Arg(4096);
+
+	// Reflects rays off normals one Vector at a time, and a Vec3Packet of 8 floats or 4 doubles at a time
+	static void BM_Vector_reflect_array(benchmark::State& state)
+	{
+		const std::size_t count = static_cast<std::size_t>(state.range(0));
+
+		std::vector<Vector> rays(count, Vector(1, -2, 3));
+		const std::vector<Vector> normals(count, Vector(0, 1, 1).normalized());
+		std::vector<Vector> result(count);
+
+		for (auto _ : state)
+		{
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				result[i] = Vector::reflect(rays[i], normals[i]);
+			}
+
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * count);
+	}
+	BENCHMARK(BM_Vector_reflect_array)->Arg(4096);
+
+	template<typename T, std::size_t W>
+	static void BM_Vec3Packet_reflect(benchmark::State& state)
+	{
+		const std::size_t count = static_cast<std::size_t>(state.range(0));
+
+		const VectorArray<T> rays(count);
+		VectorArray<T> normals(count);
+		VectorArray<T> result(count);
+
+		for (auto normal : normals)
+		{
+			normal = Vector3<T>(0, 1, 1).normalized();
+		}
+
+		using Packet3 = Vec3Packet<T, W>;
+
+		for (auto _ : state)
+		{
+			for (std::size_t i = 0; i < count; i += W)
+			{
+				const Packet3 ray = Packet3::load(rays.x() + i, rays.y() + i, rays.z() + i);
+				const Packet3 normal = Packet3::load(normals.x() + i, normals.y() + i, normals.z() + i);
+
+				Packet3::reflect(ray, normal).store(result.x() + i, result.y() + i, result.z() + i);
+			}
+
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * count);
+	}
+	BENCHMARK_TEMPLATE(BM_Vec3Packet_reflect, float, 8)->Arg(4096);
+	BENCHMARK_TEMPLATE(BM_Vec3Packet_reflect, double, 4)->Arg(4096);
+}
@@ -0,0 +1,94 @@
+#include <benchmark/benchmark.h>
+#include <vector>
+#include "RML.h"
+
+namespace RML
+{
+	// Position, normal and texture coordinates, as a mesh loader hands them over
+	static constexpr std::size_t VERTEX_SIZE = 8;
+	static constexpr std::size_t VERTEX_COUNT = 1 << 20;
+
+	static std::vector<double> bench_vertices()
+	{
+		std::vector<double> vertices(VERTEX_COUNT * VERTEX_SIZE);
+
+		for (std::size_t i = 0; i < vertices.size(); ++i)
+		{
+			vertices[i] = static_cast<double>(i % 97) * 0.25;
+		}
+
+		return vertices;
+	}
+
+	static Matrix<double, 4, 4> bench_matrix()
+	{
+		return Transform()
+			.translate(10, 5, -5)
+			.rotate(120, 50, 90)
+			.scale(10, 5, 1.2)
+			.matrix();
+	}
+
+	// Copies the positions into Points, transforms them and copies them back
+	static void BM_Vertices_copy_apply(benchmark::State& state)
+	{
+		const Matrix<double, 4, 4> matrix = bench_matrix();
+		std::vector<double> vertices = bench_vertices();
+		std::vector<Point> points(VERTEX_COUNT);
+
+		for (auto _ : state)
+		{
+			for (std::size_t i = 0; i < VERTEX_COUNT; ++i)
+			{
+				const double* p = vertices.data() + i * VERTEX_SIZE;
+				points[i] = Point(p[0], p[1], p[2]);
+			}
+
+			detail::transform_aos<true>(matrix.data(), points.data(), points.data(), points.size());
+
+			for (std::size_t i = 0; i < VERTEX_COUNT; ++i)
+			{
+				double* p = vertices.data() + i * VERTEX_SIZE;
+				p[0] = points[i].x();
+				p[1] = points[i].y();
+				p[2] = points[i].z();
+			}
+
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * VERTEX_COUNT);
+	}
+	BENCHMARK(BM_Vertices_copy_apply)->Unit(benchmark::kMillisecond);
+
+	// Transforms the positions where they are
+	static void BM_Vertices_PointSpan_apply(benchmark::State& state)
+	{
+		const Matrix<double, 4, 4> matrix = bench_matrix();
+		std::vector<double> vertices = bench_vertices();
+		PointSpan<double> positions(vertices.data(), VERTEX_COUNT, VERTEX_SIZE);
+
+		for (auto _ : state)
+		{
+			apply(matrix, positions, positions, static_cast<unsigned int>(state.range(0)));
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * VERTEX_COUNT);
+	}
+	BENCHMARK(BM_Vertices_PointSpan_apply)->Arg(1)->Arg(0)->Unit(benchmark::kMillisecond);
+
+	static void BM_MatrixView_multiply_4x4(benchmark::State& state)
+	{
+		const Matrix<double, 4, 4> a = bench_matrix();
+		const Matrix<double, 4, 4> bt = a.transpose();
+		MatrixView<const double, 4, 4, Layout::ColumnMajor> b(bt.data());
+
+		for (auto _ : state)
+		{
+			benchmark::DoNotOptimize(a);
+			benchmark::DoNotOptimize(a * b);
+		}
+	}
+	BENCHMARK(BM_MatrixView_multiply_4x4);
+}
@@ -0,0 +1,19 @@
+#include <benchmark/benchmark.h>
+#include <vector>
+
+int main(int argc, char** argv) {
+	// Report as JSON by default so runs can be diffed, e.g. with compare.py from Google Benchmark.
+	// Arguments given on the command line come later and take precedence.
+	char jsonFormat[] = "--benchmark_format=json";
+
+	std::vector<char*> args(argv, argv + argc);
+	args.insert(args.begin() + 1, jsonFormat);
+
+	int count = static_cast<int>(args.size());
+
+	::benchmark::Initialize(&count, args.data());
+	if (::benchmark::ReportUnrecognizedArguments(count, args.data())) return 1;
+	::benchmark::RunSpecifiedBenchmarks();
+	::benchmark::Shutdown();
+	return 0;
+}
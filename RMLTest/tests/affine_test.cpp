@@ -0,0 +1,268 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include "RML.h"
+
+namespace RML
+{
+	template<typename T>
+	Affine3<T> test_affine()
+	{
+		return Affine3<T>({
+			0, -2, 0, 5,
+			1, 0, 0, -2,
+			0, 0, 3, 1
+			});
+	}
+
+	TEST(RML_Affine3, construct_identity)
+	{
+		const Affine3<double> affine;
+
+		EXPECT_EQ(affine, Affine3<double>::identity());
+		EXPECT_EQ(affine.matrix(), (Matrix<double, 4, 4>::identity()));
+	}
+
+	TEST(RML_Affine3, is_smaller_than_matrix)
+	{
+		EXPECT_EQ(sizeof(Affine3<double>), sizeof(double) * 12);
+		EXPECT_EQ(sizeof(Affine3<float>), sizeof(float) * 12);
+	}
+
+	TEST(RML_Affine3, construct_from_linear_and_translation)
+	{
+		const Matrix<double, 3, 3> linear({
+			0, -2, 0,
+			1, 0, 0,
+			0, 0, 3
+			});
+
+		const Affine3<double> affine(linear, Tuple3<double>(5, -2, 1));
+
+		EXPECT_EQ(affine, test_affine<double>());
+		EXPECT_EQ(affine.linear(), linear);
+		EXPECT_EQ(affine.translation(), Tuple3<double>(5, -2, 1));
+	}
+
+	TEST(RML_Affine3, matrix_round_trip)
+	{
+		const Matrix<double, 4, 4> matrix({
+			0, -2, 0, 5,
+			1, 0, 0, -2,
+			0, 0, 3, 1,
+			0, 0, 0, 1
+			});
+
+		const Affine3<double> affine(matrix);
+
+		EXPECT_EQ(affine, test_affine<double>());
+		EXPECT_EQ(affine.matrix(), matrix);
+		EXPECT_EQ(affine(3, 3), 1);
+		EXPECT_EQ(affine(3, 0), 0);
+		EXPECT_EQ(Affine3<double>(ColMajorMatrix<double, 4, 4>(matrix)), affine);
+		EXPECT_EQ(affine.matrix<Layout::ColumnMajor>(), matrix);
+	}
+
+	TEST(RML_Affine3, data_matches_matrix)
+	{
+		const Affine3<float> affine = test_affine<float>();
+		const Matrix<float, 4, 4> matrix = affine.matrix();
+
+		for (int i = 0; i < 12; ++i)
+		{
+			EXPECT_EQ(affine.data()[i], matrix.data()[i]);
+		}
+	}
+
+	TEST(RML_Affine3, composition_matches_matrix_product)
+	{
+		const Affine3<double> a = test_affine<double>();
+		const Affine3<double> b({
+			1, 2, 3, 4,
+			2, 4, 4, 2,
+			8, 6, 4, 1
+			});
+
+		EXPECT_EQ((a * b).matrix(), a.matrix() * b.matrix());
+		EXPECT_EQ((b * a).matrix(), b.matrix() * a.matrix());
+
+		Affine3<double> c = a;
+		c *= b;
+
+		EXPECT_EQ(c, a * b);
+	}
+
+	TEST(RML_Affine3, composition_float)
+	{
+		const Affine3<float> a = test_affine<float>();
+		const Affine3<float> b({
+			1, 2, 3, 4,
+			2, 4, 4, 2,
+			8, 6, 4, 1
+			});
+
+		EXPECT_EQ((a * b).matrix(), a.matrix() * b.matrix());
+	}
+
+	TEST(RML_Affine3, composition_constant_expression)
+	{
+		constexpr Affine3<int> a({
+			0, -2, 0, 5,
+			1, 0, 0, -2,
+			0, 0, 3, 1
+			});
+
+		constexpr Affine3<int> product = a * Affine3<int>::identity();
+
+		static_assert(product(0, 3) == 5, "Affine3 composition should be usable in a constant expression");
+		EXPECT_EQ(product, a);
+	}
+
+	TEST(RML_Affine3, transform_point_and_vector)
+	{
+		const Affine3<double> affine = test_affine<double>();
+
+		const Point point(1, 2, 3);
+		const Vector vector(1, 2, 3);
+
+		EXPECT_EQ(affine.transform_point(point), affine.matrix().transform_point(point));
+		EXPECT_EQ(affine.transform_vector(vector), affine.matrix().transform_vector(vector));
+		EXPECT_EQ(affine * Tuple4<double>(1, 2, 3, 1), affine.matrix() * Tuple4<double>(1, 2, 3, 1));
+		EXPECT_EQ(affine * Tuple4<double>(1, 2, 3, 0), affine.matrix() * Tuple4<double>(1, 2, 3, 0));
+	}
+
+	TEST(RML_Affine3, inverse)
+	{
+		const Affine3<double> affine = test_affine<double>();
+
+		EXPECT_EQ(affine.determinant(), affine.matrix().determinant());
+		EXPECT_TRUE(affine.invertible());
+		EXPECT_EQ(affine.inverse().matrix(), affine.matrix().invert());
+		EXPECT_EQ(affine * affine.inverse(), Affine3<double>::identity());
+	}
+
+	TEST(RML_Affine3, inverse_not_invertible)
+	{
+		const Affine3<double> affine({
+			1, 2, 3, 4,
+			2, 4, 6, 5,
+			0, 1, 1, 6
+			});
+
+		EXPECT_FALSE(affine.invertible());
+		EXPECT_EQ(affine.inverse(), affine);
+	}
+
+	TEST(RML_Affine3, rigid_inverse)
+	{
+		const Affine3<double> affine(Quaternion::euler_angles(30, 45, 60).matrix() * Matrix<double, 4, 4>({
+			1, 0, 0, 3,
+			0, 1, 0, -4,
+			0, 0, 1, 5,
+			0, 0, 0, 1
+			}));
+
+		EXPECT_EQ(affine.rigid_inverse(), affine.inverse());
+	}
+
+	TEST(RML_Affine3, quaternion_round_trip)
+	{
+		const Quaternion rotation = Quaternion::euler_angles(10, 20, 30);
+		const Affine3<double> affine(rotation);
+
+		EXPECT_EQ(affine.matrix(), rotation.matrix());
+		EXPECT_EQ(affine.rotation().matrix(), rotation.matrix());
+	}
+
+	TEST(RML_Affine3, transform_round_trip)
+	{
+		Transform transform;
+		transform.translate(1, 2, 3);
+		transform.rotate(0, 90, 0);
+		transform.scale(2, 3, 4);
+
+		const Affine3<double> affine(transform);
+
+		EXPECT_EQ(affine.matrix(), transform.matrix());
+		EXPECT_EQ(affine.transform(), transform);
+		EXPECT_EQ(Affine3<float>(transform).matrix(), (Matrix<float, 4, 4>(transform.matrix())));
+	}
+
+	TEST(RML_Affine3, apply_points_and_vectors)
+	{
+		const Affine3<double> affine = test_affine<double>();
+
+		std::vector<Point> points;
+		std::vector<Vector> vectors;
+
+		for (int i = 0; i < 50; ++i)
+		{
+			points.emplace_back(i, i * 0.5, -i);
+			vectors.emplace_back(-i, 1, i * 2.0);
+		}
+
+		std::vector<Point> transformedPoints(points.size());
+		std::vector<Vector> transformedVectors(vectors.size());
+
+		affine.apply(points.data(), transformedPoints.data(), points.size());
+		affine.apply(vectors.data(), transformedVectors.data(), vectors.size(), 0);
+
+		for (std::size_t i = 0; i < points.size(); ++i)
+		{
+			EXPECT_EQ(transformedPoints[i], affine.transform_point(points[i]));
+			EXPECT_EQ(transformedVectors[i], affine.transform_vector(vectors[i]));
+		}
+	}
+
+	TEST(RML_Affine3, apply_soa)
+	{
+		const Affine3<float> affine = test_affine<float>();
+
+		std::vector<float> x(37), y(37), z(37);
+
+		for (int i = 0; i < 37; ++i)
+		{
+			x[i] = static_cast<float>(i);
+			y[i] = static_cast<float>(i) * 0.25f;
+			z[i] = -static_cast<float>(i);
+		}
+
+		std::vector<float> px(37), py(37), pz(37);
+		std::vector<float> vx(37), vy(37), vz(37);
+
+		affine.apply(x.data(), y.data(), z.data(), px.data(), py.data(), pz.data(), x.size());
+		affine.apply_vectors(x.data(), y.data(), z.data(), vx.data(), vy.data(), vz.data(), x.size());
+
+		for (std::size_t i = 0; i < x.size(); ++i)
+		{
+			EXPECT_EQ(Tuple4<float>(px[i], py[i], pz[i], 1), affine.transform_point(Tuple4<float>(x[i], y[i], z[i], 1)));
+			EXPECT_EQ(Tuple4<float>(vx[i], vy[i], vz[i], 0), affine.transform_vector(Tuple4<float>(x[i], y[i], z[i], 0)));
+		}
+	}
+
+	TEST(RML_Affine3, apply_point_span)
+	{
+		const Affine3<double> affine = test_affine<double>();
+
+		// Position and a padding number per vertex
+		std::vector<double> vertices(4 * 20);
+
+		for (std::size_t i = 0; i < 20; ++i)
+		{
+			vertices[i * 4 + 0] = static_cast<double>(i);
+			vertices[i * 4 + 1] = 1;
+			vertices[i * 4 + 2] = -static_cast<double>(i);
+			vertices[i * 4 + 3] = 42;
+		}
+
+		const std::vector<double> original = vertices;
+		PointSpan<double> span(vertices.data(), 20, 4);
+
+		apply(affine, span, span);
+
+		for (std::size_t i = 0; i < 20; ++i)
+		{
+			EXPECT_EQ(Point(span[i]), affine.transform_point(Point(PointSpan<const double>(original.data(), 20, 4)[i])));
+			EXPECT_EQ(vertices[i * 4 + 3], 42);
+		}
+	}
+}
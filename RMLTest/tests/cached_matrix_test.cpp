@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+#include "RML.h"
+
+namespace RML
+{
+	TEST(RML_CachedMatrix, determinant)
+	{
+		CachedMatrix<float, 4, 4> matrix(Matrix<float, 4, 4>({
+			6, 4, 4, 4,
+			5, 5, 7, 6,
+			4, -9, 3, -7,
+			9, 1, 7, -6
+			}));
+
+		EXPECT_EQ(matrix.determinant(), -2120);
+		EXPECT_EQ(matrix.determinant(), -2120);
+		EXPECT_TRUE(matrix.invertible());
+	}
+
+	TEST(RML_CachedMatrix, invert)
+	{
+		Matrix<float, 4, 4> a({
+			8, -5, 9, 2,
+			7, 5, 6, 1,
+			-6, 0, 9, 6,
+			-3, 0, -9, -4
+			});
+
+		CachedMatrix<float, 4, 4> cached(a);
+
+		EXPECT_EQ(cached.invert(), a.invert());
+		EXPECT_EQ(&cached.invert(), &cached.invert());
+	}
+
+	TEST(RML_CachedMatrix, set_clears_cache)
+	{
+		CachedMatrix<float, 2, 2> matrix(Matrix<float, 2, 2>({
+			1, 5,
+			-3, 2
+			}));
+
+		EXPECT_EQ(matrix.determinant(), 17);
+
+		matrix.set(0, 0, 2);
+
+		EXPECT_EQ(matrix(0, 0), 2);
+		EXPECT_EQ(matrix.determinant(), 19);
+	}
+
+	TEST(RML_CachedMatrix, assign_clears_cache)
+	{
+		CachedMatrix<float, 2, 2> matrix(Matrix<float, 2, 2>({
+			1, 5,
+			-3, 2
+			}));
+
+		EXPECT_EQ(matrix.determinant(), 17);
+
+		matrix = Matrix<float, 2, 2>::identity();
+
+		EXPECT_EQ(matrix.determinant(), 1);
+		EXPECT_EQ(matrix.invert(), (Matrix<float, 2, 2>::identity()));
+	}
+}
@@ -57,4 +57,18 @@ namespace RML
 		EXPECT_FALSE(RML::equal(INF, -INF));
 		EXPECT_FALSE(RML::equal(INF, 245123.123));
 	}
+
+	TEST(RML_Comparison, compare_fractional_difference_double)
+	{
+		EXPECT_FALSE(RML::equal(0.5, 0.0));
+		EXPECT_FALSE(RML::equal(-0.5, 0.0));
+	}
+
+	TEST(RML_Comparison, compare_in_constant_expression)
+	{
+		static_assert(RML::equal(1.0, 1.000001));
+		static_assert(!RML::equal(1.0, 1.1));
+		static_assert(RML::equal(INF, INF));
+		static_assert(!RML::equal(INF, -INF));
+	}
 }
@@ -0,0 +1,256 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <utility>
+#include "RML.h"
+
+namespace RML
+{
+	TEST(RML_DynamicMatrix, construct_blank_matrix)
+	{
+		DynamicMatrix<double> matrix(3, 5);
+
+		EXPECT_EQ(matrix.rows(), 3);
+		EXPECT_EQ(matrix.columns(), 5);
+		EXPECT_EQ(matrix.size(), 15u);
+
+		for (int row = 0; row < 3; ++row)
+		{
+			for (int col = 0; col < 5; ++col)
+			{
+				EXPECT_EQ(matrix(row, col), 0);
+			}
+		}
+	}
+
+	TEST(RML_DynamicMatrix, construct_empty_matrix)
+	{
+		DynamicMatrix<double> matrix;
+
+		EXPECT_EQ(matrix.rows(), 0);
+		EXPECT_EQ(matrix.columns(), 0);
+		EXPECT_EQ(matrix.data(), nullptr);
+	}
+
+	TEST(RML_DynamicMatrix, construct_matrix_2x3)
+	{
+		DynamicMatrix<int> matrix(2, 3, {
+			1, 2, 3,
+			4, 5, 6
+			});
+
+		EXPECT_EQ(matrix(0, 2), 3);
+		EXPECT_EQ(matrix(1, 0), 4);
+		EXPECT_EQ(matrix(1, 2), 6);
+	}
+
+	TEST(RML_DynamicMatrix, data_is_aligned)
+	{
+		DynamicMatrix<float> matrix(7, 3);
+
+		EXPECT_EQ(reinterpret_cast<std::uintptr_t>(matrix.data()) % detail::HEAP_ALIGNMENT, 0u);
+	}
+
+	TEST(RML_DynamicMatrix, copy_is_deep)
+	{
+		DynamicMatrix<double> original(2, 2, { 1, 2, 3, 4 });
+		DynamicMatrix<double> copy = original;
+
+		original(0, 0) = 10;
+
+		EXPECT_EQ(copy(0, 0), 1);
+		EXPECT_NE(copy.data(), original.data());
+
+		copy = original;
+
+		EXPECT_EQ(copy, original);
+	}
+
+	TEST(RML_DynamicMatrix, move_passes_data_on)
+	{
+		DynamicMatrix<double> original(4, 4);
+		const double* data = original.data();
+
+		DynamicMatrix<double> moved = std::move(original);
+
+		EXPECT_EQ(moved.data(), data);
+		EXPECT_EQ(moved.rows(), 4);
+		EXPECT_EQ(original.rows(), 0);
+		EXPECT_EQ(original.columns(), 0);
+
+		DynamicMatrix<double> assigned;
+		assigned = std::move(moved);
+
+		EXPECT_EQ(assigned.data(), data);
+		EXPECT_EQ(moved.rows(), 0);
+	}
+
+	TEST(RML_DynamicMatrix, identity)
+	{
+		EXPECT_EQ(DynamicMatrix<double>::identity(4), DynamicMatrix<double>(Matrix<double, 4, 4>::identity()));
+	}
+
+	TEST(RML_DynamicMatrix, multiplication_3x2_2x4)
+	{
+		Matrix<int, 3, 2> a({
+			1, 2,
+			3, 4,
+			5, 6
+			});
+
+		Matrix<int, 2, 4> b({
+			1, 2, 3, 4,
+			5, 6, 7, 8
+			});
+
+		DynamicMatrix<int> result = DynamicMatrix<int>(a) * DynamicMatrix<int>(b);
+
+		EXPECT_EQ(result.rows(), 3);
+		EXPECT_EQ(result.columns(), 4);
+		EXPECT_EQ(result, DynamicMatrix<int>(a * b));
+	}
+
+	TEST(RML_DynamicMatrix, multiplication_large)
+	{
+		// Large enough to use the blocked product
+		DynamicMatrix<double> a(50, 70);
+		DynamicMatrix<double> b(70, 30);
+
+		for (int row = 0; row < 70; ++row)
+		{
+			for (int col = 0; col < 70; ++col)
+			{
+				if (row < 50) a(row, col) = (row * 3 + col) % 7 - 3.0;
+				if (col < 30) b(row, col) = (row + col * 5) % 11 - 5.0;
+			}
+		}
+
+		const DynamicMatrix<double> product = a * b;
+
+		double expected = 0;
+
+		for (int i = 0; i < 70; ++i)
+		{
+			expected += a(49, i) * b(i, 29);
+		}
+
+		EXPECT_EQ(product(49, 29), expected);
+		EXPECT_EQ(a.multiply(b, 1), product);
+	}
+
+	TEST(RML_DynamicMatrix, multiplication_undefined)
+	{
+		DynamicMatrix<double> a(2, 3);
+		DynamicMatrix<double> b(2, 3);
+
+		DynamicMatrix<double> result = a * b;
+
+		EXPECT_EQ(result.rows(), 0);
+		EXPECT_EQ(result.columns(), 0);
+	}
+
+	TEST(RML_DynamicMatrix, transpose_2x4)
+	{
+		Matrix<int, 2, 4> matrix({
+			1, 2, 3, 4,
+			5, 6, 7, 8
+			});
+
+		EXPECT_EQ(DynamicMatrix<int>(matrix).transpose(), DynamicMatrix<int>(matrix.transpose()));
+	}
+
+	TEST(RML_DynamicMatrix, determinant_4x4)
+	{
+		DynamicMatrix<float> matrix(4, 4, {
+			-2, -8, 3, 5,
+			-3, 1, 7, 3,
+			1, 2, -9, 6,
+			-6, 7, 7, -9
+			});
+
+		EXPECT_NEAR(matrix.cofactor(0, 0), 690, 0.01);
+		EXPECT_NEAR(matrix.cofactor(0, 3), 51, 0.01);
+		EXPECT_NEAR(matrix.determinant(), -4071, 0.01);
+	}
+
+	TEST(RML_DynamicMatrix, determinant_int_requires_pivoting)
+	{
+		DynamicMatrix<int> matrix(4, 4, {
+			0, 2, 1, 3,
+			1, 1, 1, 0,
+			2, 0, 3, 1,
+			1, 4, 0, 2
+			});
+
+		EXPECT_EQ(matrix.determinant(), (Matrix<int, 4, 4>({
+			0, 2, 1, 3,
+			1, 1, 1, 0,
+			2, 0, 3, 1,
+			1, 4, 0, 2
+			}).determinant()));
+	}
+
+	TEST(RML_DynamicMatrix, determinant_non_square)
+	{
+		EXPECT_EQ(DynamicMatrix<double>(2, 3).determinant(), 0);
+	}
+
+	TEST(RML_DynamicMatrix, inversion_4x4)
+	{
+		Matrix<float, 4, 4> a({
+			-5, 2, 6, -8,
+			1, -5, 1, 8,
+			7, 7, -6, -7,
+			1, -3, 7, 4
+			});
+
+		float determinant = 0;
+		DynamicMatrix<float> b = DynamicMatrix<float>(a).invert(determinant);
+
+		EXPECT_NEAR(determinant, 532, 0.01);
+		EXPECT_EQ(b, DynamicMatrix<float>(a.invert()));
+	}
+
+	TEST(RML_DynamicMatrix, inversion_not_invertible)
+	{
+		DynamicMatrix<double> a(3, 3, {
+			1, 2, 3,
+			2, 4, 6,
+			0, 1, 1
+			});
+
+		double determinant = 1;
+		DynamicMatrix<double> b = a.invert(determinant);
+
+		EXPECT_FALSE(a.invertible());
+		EXPECT_EQ(determinant, 0);
+		EXPECT_EQ(b, a);
+	}
+
+	TEST(RML_DynamicMatrix, multiply_by_inverse_12x12)
+	{
+		DynamicMatrix<double> a(12, 12);
+
+		for (int row = 0; row < 12; ++row)
+		{
+			for (int col = 0; col < 12; ++col)
+			{
+				a(row, col) = row == col ? 12 : ((row * 7 + col * 3) % 5) - 2.0;
+			}
+		}
+
+		EXPECT_EQ(a * a.invert(), DynamicMatrix<double>::identity(12));
+	}
+
+	TEST(RML_DynamicMatrix, convert_to_matrix)
+	{
+		Matrix<double, 2, 3> matrix({
+			1, 2, 3,
+			4, 5, 6
+			});
+
+		DynamicMatrix<double> dynamic = matrix;
+
+		EXPECT_EQ((static_cast<Matrix<double, 2, 3>>(dynamic)), matrix);
+		EXPECT_EQ((static_cast<Matrix<double, 3, 2>>(dynamic)), (Matrix<double, 3, 2>()));
+	}
+}
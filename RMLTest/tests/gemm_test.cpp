@@ -0,0 +1,156 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include "RML.h"
+
+namespace RML
+{
+	template<typename T, int ROW, int COL>
+	Matrix<T, ROW, COL> numbered(const int seed)
+	{
+		Matrix<T, ROW, COL> matrix;
+
+		for (int row = 0; row < ROW; ++row)
+		{
+			for (int col = 0; col < COL; ++col)
+			{
+				matrix(row, col) = static_cast<T>(((row * 31 + col * 17 + seed) % 13) - 6);
+			}
+		}
+
+		return matrix;
+	}
+
+	template<typename T, int ROW, int COL, int COL2>
+	Matrix<T, ROW, COL2> naive_product(const Matrix<T, ROW, COL>& lhs, const Matrix<T, COL, COL2>& rhs)
+	{
+		Matrix<T, ROW, COL2> result;
+
+		for (int row = 0; row < ROW; ++row)
+		{
+			for (int col = 0; col < COL2; ++col)
+			{
+				T value = 0;
+
+				for (int i = 0; i < COL; ++i)
+				{
+					value += lhs(row, i) * rhs(i, col);
+				}
+
+				result(row, col) = value;
+			}
+		}
+
+		return result;
+	}
+
+	TEST(RML_Gemm, product_odd_size_double)
+	{
+		const auto lhs = numbered<double, 37, 53>(1);
+		const auto rhs = numbered<double, 53, 41>(2);
+
+		EXPECT_EQ(lhs * rhs, naive_product(lhs, rhs));
+	}
+
+	TEST(RML_Gemm, product_odd_size_float)
+	{
+		const auto lhs = numbered<float, 45, 39>(3);
+		const auto rhs = numbered<float, 39, 51>(4);
+
+		EXPECT_EQ(lhs * rhs, naive_product(lhs, rhs));
+	}
+
+	TEST(RML_Gemm, product_odd_size_int)
+	{
+		const auto lhs = numbered<int, 33, 35>(5);
+		const auto rhs = numbered<int, 35, 37>(6);
+
+		EXPECT_EQ(lhs * rhs, naive_product(lhs, rhs));
+	}
+
+	TEST(RML_Gemm, product_spans_several_blocks)
+	{
+		// Larger than one block of b in both directions, so the partial sums of every block are added together
+		const auto lhs = numbered<double, 20, 300>(7);
+		const auto rhs = numbered<double, 300, 270>(8);
+
+		EXPECT_EQ(lhs * rhs, naive_product(lhs, rhs));
+	}
+
+	TEST(RML_Gemm, multithreaded_product_matches_single_thread)
+	{
+		const auto lhs = numbered<double, 130, 128>(9);
+		const auto rhs = numbered<double, 128, 128>(10);
+
+		const auto single = lhs.multiply(rhs, 1);
+
+		EXPECT_EQ(single, naive_product(lhs, rhs));
+		EXPECT_EQ(lhs.multiply(rhs, 4), single);
+		EXPECT_EQ(lhs.multiply(rhs, 0), single);
+	}
+
+	TEST(RML_Gemm, matrix_threads)
+	{
+		const unsigned int original = matrix_threads();
+
+		set_matrix_threads(3);
+		EXPECT_EQ(matrix_threads(), 3u);
+
+		set_matrix_threads(original);
+		EXPECT_EQ(matrix_threads(), original);
+	}
+
+	TEST(RML_Gemm, storage_small_matrix_stays_on_stack)
+	{
+		EXPECT_TRUE((std::is_trivially_copyable<Matrix<double, 4, 4>>::value));
+		EXPECT_EQ(sizeof(Matrix<double, 4, 4>), sizeof(double) * 16);
+	}
+
+	TEST(RML_Gemm, storage_large_matrix_on_heap)
+	{
+		EXPECT_FALSE((std::is_trivially_copyable<Matrix<double, 64, 64>>::value));
+		EXPECT_LT(sizeof(Matrix<double, 64, 64>), sizeof(double) * 64 * 64);
+	}
+
+	TEST(RML_Gemm, storage_large_matrix_copy_is_deep)
+	{
+		auto original = numbered<double, 64, 64>(11);
+		const auto copy = original;
+
+		original(3, 5) = 100;
+
+		EXPECT_EQ(copy(3, 5), (numbered<double, 64, 64>(11)(3, 5)));
+		EXPECT_EQ(original(3, 5), 100);
+	}
+
+	TEST(RML_Gemm, storage_large_matrix_move)
+	{
+		auto original = numbered<double, 64, 64>(12);
+		const double* data = original.data();
+
+		const auto moved = std::move(original);
+
+		EXPECT_EQ(moved.data(), data);
+		EXPECT_EQ(moved, (numbered<double, 64, 64>(12)));
+	}
+
+	TEST(RML_Gemm, storage_large_matrix_aligned)
+	{
+		const Matrix<double, 64, 64> matrix;
+
+		EXPECT_EQ(reinterpret_cast<std::uintptr_t>(matrix.data()) % detail::HEAP_ALIGNMENT, 0u);
+		EXPECT_EQ(matrix(63, 63), 0);
+	}
+
+	TEST(RML_Gemm, storage_large_matrix_lu)
+	{
+		auto matrix = Matrix<double, 64, 64>::identity();
+		matrix(0, 63) = 2;
+
+		const auto inverse = LU<double, 64>(matrix).inverse();
+
+		EXPECT_EQ(inverse(0, 63), -2);
+		EXPECT_EQ(matrix * inverse, (Matrix<double, 64, 64>::identity()));
+	}
+}
@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+#include "RML.h"
+
+namespace RML
+{
+	TEST(RML_LU, determinant_5x5)
+	{
+		Matrix<double, 5, 5> matrix({
+			2, -1, 0, 3, 1,
+			4, 1, -2, 0, 5,
+			0, 3, 1, -1, 2,
+			1, 0, 4, 2, -3,
+			-2, 2, 1, 0, 1
+			});
+
+		LU<double, 5> lu(matrix);
+
+		EXPECT_FALSE(lu.singular());
+		EXPECT_TRUE(equal(lu.determinant(), -58.0));
+	}
+
+	TEST(RML_LU, determinant_requires_pivoting)
+	{
+		Matrix<double, 3, 3> matrix({
+			0, 2, 1,
+			1, 1, 1,
+			2, 0, 3
+			});
+
+		EXPECT_TRUE(equal((LU<double, 3>(matrix).determinant()), -4.0));
+	}
+
+	TEST(RML_LU, matrix_determinant_5x5_matches_cofactor_expansion)
+	{
+		Matrix<int, 5, 5> a({
+			2, -1, 0, 3, 1,
+			4, 1, -2, 0, 5,
+			0, 3, 1, -1, 2,
+			1, 0, 4, 2, -3,
+			-2, 2, 1, 0, 1
+			});
+
+		Matrix<double, 5, 5> b = a;
+
+		EXPECT_EQ(a.determinant(), -58);
+		EXPECT_TRUE(equal(b.determinant(), -58.0));
+	}
+
+	TEST(RML_LU, singular)
+	{
+		Matrix<double, 5, 5> matrix({
+			1, 2, 3, 4, 5,
+			2, 4, 6, 8, 10,
+			0, 1, 0, 1, 0,
+			3, 1, 4, 1, 5,
+			9, 2, 6, 5, 3
+			});
+
+		LU<double, 5> lu(matrix);
+
+		EXPECT_TRUE(lu.singular());
+		EXPECT_EQ(lu.determinant(), 0);
+		EXPECT_FALSE(matrix.invertible());
+	}
+
+	TEST(RML_LU, solve_6x6)
+	{
+		Matrix<double, 6, 6> matrix({
+			4, -2, 1, 0, 3, 1,
+			1, 5, -1, 2, 0, 2,
+			0, 1, 6, -2, 1, 0,
+			2, 0, 1, 7, -1, 3,
+			-1, 3, 0, 1, 8, -2,
+			1, 1, 1, 1, 1, 9
+			});
+
+		Matrix<double, 6, 1> expectedResult({ 1, -2, 3, -4, 5, -6 });
+
+		Matrix<double, 6, 1> rhs = matrix * expectedResult;
+
+		EXPECT_EQ((LU<double, 6>(matrix).solve(rhs)), expectedResult);
+	}
+
+	TEST(RML_LU, solve_tuple)
+	{
+		Matrix<double, 4, 4> matrix({
+			8, -5, 9, 2,
+			7, 5, 6, 1,
+			-6, 0, 9, 6,
+			-3, 0, -9, -4
+			});
+
+		Tuple4<double> expectedResult(1, 2, 3, 4);
+
+		Tuple4<double> rhs = matrix * expectedResult;
+
+		EXPECT_EQ((LU<double, 4>(matrix).solve(rhs)), expectedResult);
+	}
+
+	TEST(RML_LU, inverse_matches_closed_form_inverse)
+	{
+		Matrix<double, 4, 4> matrix({
+			-5, 2, 6, -8,
+			1, -5, 1, 8,
+			7, 7, -6, -7,
+			1, -3, 7, 4
+			});
+
+		EXPECT_EQ((LU<double, 4>(matrix).inverse()), matrix.invert());
+	}
+
+	TEST(RML_LU, matrix_inversion_12x12)
+	{
+		Matrix<double, 12, 12> matrix;
+
+		for (int row = 0; row < 12; ++row)
+		{
+			for (int col = 0; col < 12; ++col)
+			{
+				matrix(row, col) = row == col ? 12.0 : ((row * 7 + col * 3) % 5) - 2.0;
+			}
+		}
+
+		double determinant = 0;
+		auto inverted = matrix.invert(determinant);
+
+		EXPECT_NE(determinant, 0);
+		EXPECT_EQ(matrix * inverted, (Matrix<double, 12, 12>::identity()));
+	}
+}
@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+#include "RML.h"
+
+namespace RML
+{
+	using namespace RML::expr;
+
+	static const Matrix<double, 4, 4> A({
+		1, 2, 3, 4,
+		5, 6, 7, 8,
+		9, 8, 7, 6,
+		5, 4, 3, 2
+		});
+
+	static const Matrix<double, 4, 4> B({
+		-2, 1, 2, 3,
+		3, 2, 1, -1,
+		4, 3, 6, 5,
+		1, 2, 7, 8
+		});
+
+	static const Matrix<double, 4, 4> C({
+		0, 1, 0, 5,
+		1, 0, 0, -3,
+		0, 0, 1, 2,
+		0, 0, 0, 1
+		});
+
+	TEST(RML_MatrixExpr, product_chain_matches_eager_product)
+	{
+		Matrix<double, 4, 4> result = lazy(A) * B * C;
+
+		EXPECT_EQ(result, A * B * C);
+	}
+
+	TEST(RML_MatrixExpr, product_chain_with_column)
+	{
+		Matrix<double, 4, 1> column({ 1, 2, 3, 1 });
+
+		Matrix<double, 4, 1> result = lazy(A) * B * C * column;
+
+		EXPECT_EQ(result, A * B * C * column);
+	}
+
+	TEST(RML_MatrixExpr, product_chain_of_mixed_shapes)
+	{
+		Matrix<double, 1, 4> row({ 1, -1, 2, 0 });
+		Matrix<double, 4, 1> column({ 1, 2, 3, 1 });
+
+		Matrix<double, 1, 1> result = lazy(row) * A * B * column;
+
+		EXPECT_EQ(result, row * A * B * column);
+	}
+
+	TEST(RML_MatrixExpr, evaluation_order)
+	{
+		Matrix<double, 4, 1> column({ 1, 2, 3, 1 });
+
+		// (A * B) * column is cheaper as A * (B * column)
+		static_assert(cheaper_right_first<Product<Leaf<double, 4, 4>, Leaf<double, 4, 4>>, Leaf<double, 4, 1>>());
+		// (A * B) * C costs the same either way, so it keeps its order
+		static_assert(!cheaper_right_first<Product<Leaf<double, 4, 4>, Leaf<double, 4, 4>>, Leaf<double, 4, 4>>());
+		// row * (A * B) is cheaper as (row * A) * B
+		static_assert(cheaper_left_first<Leaf<double, 1, 4>, Product<Leaf<double, 4, 4>, Leaf<double, 4, 4>>>());
+
+		EXPECT_EQ((lazy(A) * B * column).evaluate(), A * (B * column));
+	}
+
+	TEST(RML_MatrixExpr, sum_and_difference)
+	{
+		Matrix<double, 4, 4> sum = lazy(A) + B;
+		Matrix<double, 4, 4> difference = lazy(A) - B - C;
+
+		EXPECT_EQ(sum(0, 0), -1);
+		EXPECT_EQ(sum(3, 3), 10);
+		EXPECT_EQ(difference(0, 3), -4);
+		EXPECT_EQ(difference(1, 0), 1);
+	}
+
+	TEST(RML_MatrixExpr, sum_of_products)
+	{
+		Matrix<double, 4, 4> result = lazy(A) * B + B * C;
+		Matrix<double, 4, 4> eager = A * B;
+		Matrix<double, 4, 4> other = B * C;
+
+		for (int row = 0; row < 4; ++row)
+		{
+			for (int col = 0; col < 4; ++col)
+			{
+				EXPECT_EQ(result(row, col), eager(row, col) + other(row, col));
+			}
+		}
+	}
+
+	TEST(RML_MatrixExpr, transpose)
+	{
+		Matrix<double, 4, 4> result = transpose(lazy(A));
+		Matrix<double, 4, 4> product = transpose(lazy(A) * B);
+
+		EXPECT_EQ(result, A.transpose());
+		EXPECT_EQ(product, (A * B).transpose());
+	}
+
+	TEST(RML_MatrixExpr, assigns_to_existing_matrix)
+	{
+		Matrix<double, 4, 4> result;
+
+		result = lazy(C) * C;
+
+		EXPECT_EQ(result, C * C);
+	}
+}
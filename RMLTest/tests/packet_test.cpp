@@ -0,0 +1,155 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include "RML.h"
+
+namespace RML
+{
+	static std::vector<Vector> packet_vectors(const int count, const double offset)
+	{
+		std::vector<Vector> vectors;
+
+		for (int i = 0; i < count; ++i)
+		{
+			vectors.emplace_back(i + offset, (i % 3) - 1.5, 2 - i * 0.25);
+		}
+
+		return vectors;
+	}
+
+	TEST(RML_Packet, load_store_and_lanes)
+	{
+		const float values[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+		const Packet<float, 8> packet = Packet<float, 8>::load(values);
+
+		float stored[8];
+		(packet * 2.0f + Packet<float, 8>(1)).store(stored);
+
+		for (int i = 0; i < 8; ++i)
+		{
+			EXPECT_EQ(packet[i], values[i]);
+			EXPECT_EQ(stored[i], values[i] * 2 + 1);
+		}
+	}
+
+	TEST(RML_Packet, masks_and_select)
+	{
+		const double values[4] = { -2, 5, 0.5, 3 };
+		const Packet<double, 4> packet = Packet<double, 4>::load(values);
+
+		const PacketMask<double, 4> positive = packet > Packet<double, 4>(0);
+		const PacketMask<double, 4> small = packet < Packet<double, 4>(4);
+
+		EXPECT_EQ(positive.bits(), 0b1110u);
+		EXPECT_EQ((positive & small).bits(), 0b1100u);
+		EXPECT_EQ((positive | small).bits(), 0b1111u);
+		EXPECT_EQ((!positive).bits(), 0b0001u);
+		EXPECT_TRUE((positive | small).all());
+		EXPECT_TRUE(positive.any());
+		EXPECT_FALSE(positive[0]);
+		EXPECT_TRUE((PacketMask<double, 4>::all_lanes(false).none()));
+
+		const Packet<double, 4> clamped = Packet<double, 4>::select(positive, packet, Packet<double, 4>(0));
+
+		EXPECT_EQ(clamped[0], 0);
+		EXPECT_EQ(clamped[1], 5);
+		EXPECT_EQ(clamped[2], 0.5);
+		EXPECT_EQ((Packet<double, 4>::max(packet, Packet<double, 4>(1))[2]), 1);
+	}
+
+	TEST(RML_Vec3Packet, matches_vector_operations)
+	{
+		const std::vector<Vector> a = packet_vectors(8, 1);
+		const std::vector<Vector> b = packet_vectors(8, -3);
+
+		const Vec3x8f pa = Vec3x8f::load(a.data());
+		const Vec3x8f pb = Vec3x8f::load(b.data());
+
+		const Packet<float, 8> dots = Vec3x8f::dot(pa, pb);
+		const Packet<float, 8> angles = Vec3x8f::angle(pa, pb);
+		const Packet<float, 8> signedAngles = Vec3x8f::signed_angle(pa, pb, Vec3x8f(Vector3<float>(0, 0, 1)));
+		const Vec3x8f crosses = Vec3x8f::cross(pa, pb);
+		const Vec3x8f normals = pb.normalized();
+		const Vec3x8f reflections = Vec3x8f::reflect(pa, normals);
+
+		for (std::size_t i = 0; i < 8; ++i)
+		{
+			EXPECT_FLOAT_EQ(dots[i], static_cast<float>(Vector::dot(a[i], b[i])));
+			EXPECT_NEAR(angles[i], Vector::angle(a[i], b[i]), 1e-3);
+			EXPECT_NEAR(signedAngles[i], Vector::signed_angle(a[i], b[i], Vector(0, 0, 1)), 1e-3);
+			EXPECT_EQ(crosses[i], Vector3<float>(Vector::cross(a[i], b[i])));
+			EXPECT_EQ(normals[i], Vector3<float>(b[i].normalized()));
+			EXPECT_EQ(reflections[i], Vector3<float>(Vector::reflect(a[i], b[i].normalized())));
+			EXPECT_FLOAT_EQ(pa.magnitude()[i], static_cast<float>(a[i].magnitude()));
+		}
+	}
+
+	TEST(RML_Vec3Packet, select_vectors)
+	{
+		const Vec3x4d a(Vector3<double>(1, 2, 3));
+		const Vec3x4d b(Vector(4, 5, 6));
+
+		const double t[4] = { 1, -1, 2, -2 };
+		const Vec3x4d chosen = Vec3x4d::select(Packet<double, 4>::load(t) > Packet<double, 4>(0), a, b);
+
+		EXPECT_EQ(chosen[0], Vector3<double>(1, 2, 3));
+		EXPECT_EQ(chosen[1], Vector3<double>(4, 5, 6));
+		EXPECT_EQ(chosen[2], Vector3<double>(1, 2, 3));
+		EXPECT_EQ(chosen[3], Vector3<double>(4, 5, 6));
+	}
+
+	TEST(RML_Vec3Packet, load_and_store_points)
+	{
+		const std::vector<Point> points = { Point(1, 2, 3), Point(4, 5, 6), Point(7, 8, 9) };
+
+		const Vec3x4d packet = Vec3x4d::load(points.data(), points.size());
+
+		EXPECT_EQ(packet[2], Vector3<double>(7, 8, 9));
+		EXPECT_EQ(packet[3], Vector3<double>(0, 0, 0));
+
+		std::vector<Point> moved(3);
+		(packet + Vec3x4d(Vector3<double>(1, 1, 1))).store(moved.data(), moved.size());
+
+		EXPECT_EQ(moved[1], Point(5, 6, 7));
+		EXPECT_EQ(moved[1].w(), 1);
+
+		std::vector<Vector3<float>> vectors(4);
+		Vec3x8f(Vector3<float>(1, 2, 3)).store(vectors.data(), vectors.size());
+
+		EXPECT_EQ(vectors[3], Vector3<float>(1, 2, 3));
+
+		PointArray<double> array = { Point3<double>(1, 2, 3), Point3<double>(4, 5, 6), Point3<double>(7, 8, 9), Point3<double>(0, 1, 0) };
+		const Vec3x4d soa = Vec3x4d::load(array.x(), array.y(), array.z());
+		(soa * 2.0).store(array.x(), array.y(), array.z());
+
+		EXPECT_EQ(array[3], Point3<double>(0, 2, 0));
+	}
+
+	TEST(RML_Vec3Packet, transform_and_rotate)
+	{
+		Transform transform;
+		transform.translate(1, 2, 3);
+		transform.rotate(10, 20, 30);
+		transform.scale(2, 3, 4);
+
+		const Matrix<float, 4, 4> matrix(transform.matrix());
+		const Quaternion rotation = Quaternion::euler_angles(30, 45, 60);
+
+		const std::vector<Vector> vectors = packet_vectors(8, 0.5);
+		const Vec3x8f packet = Vec3x8f::load(vectors.data());
+
+		const Vec3x8f points = packet.transform_point(matrix);
+		const Vec3x8f directions = packet.transform_vector(matrix);
+		const Vec3x8f rotated = packet.rotated(rotation);
+
+		for (std::size_t i = 0; i < 8; ++i)
+		{
+			const Tuple4<float> tuple(static_cast<float>(vectors[i].x()), static_cast<float>(vectors[i].y()), static_cast<float>(vectors[i].z()), 0);
+			const Tuple4<float> point = matrix.transform_point(tuple);
+			const Tuple4<float> direction = matrix.transform_vector(tuple);
+
+			EXPECT_EQ(points[i], Vector3<float>(point.x(), point.y(), point.z()));
+			EXPECT_EQ(directions[i], Vector3<float>(direction.x(), direction.y(), direction.z()));
+			EXPECT_EQ(rotated[i], Vector3<float>(Vector(rotation.matrix() * vectors[i])));
+		}
+	}
+}
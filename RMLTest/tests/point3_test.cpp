@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+#include <type_traits>
+#include <vector>
+#include "RML.h"
+
+namespace RML
+{
+	template<typename A, typename B, typename = void>
+	struct can_add : std::false_type {};
+
+	template<typename A, typename B>
+	struct can_add<A, B, std::void_t<decltype(std::declval<A>() + std::declval<B>())>> : std::true_type {};
+
+	TEST(RML_Point3, is_smaller_than_point)
+	{
+		EXPECT_EQ(sizeof(Point3<float>), 12u);
+		EXPECT_EQ(sizeof(Point3<double>), 24u);
+		EXPECT_LT(sizeof(Point3<double>), sizeof(Point));
+	}
+
+	TEST(RML_Point3, difference_of_points_is_a_vector)
+	{
+		const Point3<double> a(3, 2, 1);
+		const Point3<double> b(5, 6, 7);
+
+		const auto difference = a - b;
+
+		EXPECT_TRUE((std::is_same<decltype(difference), const Vector3<double>>::value));
+		EXPECT_EQ(difference, Vector3<double>(-2, -4, -6));
+	}
+
+	TEST(RML_Point3, moving_a_point_by_a_vector)
+	{
+		Point3<double> point(3, 2, 1);
+		const Vector3<double> offset(5, 6, 7);
+
+		EXPECT_EQ(point + offset, Point3<double>(8, 8, 8));
+		EXPECT_EQ(point - offset, Point3<double>(-2, -4, -6));
+
+		point += offset;
+
+		EXPECT_EQ(point, Point3<double>(8, 8, 8));
+	}
+
+	TEST(RML_Point3, points_cannot_be_added)
+	{
+		EXPECT_FALSE((can_add<Point3<double>, Point3<double>>::value));
+		EXPECT_TRUE((can_add<Point3<double>, Vector3<double>>::value));
+		EXPECT_TRUE((can_add<Vector3<double>, Vector3<double>>::value));
+	}
+
+	TEST(RML_Point3, converts_to_and_from_point)
+	{
+		const Point point(1, 2, 3);
+		const Point3<float> point3(point);
+
+		EXPECT_EQ(point3, Point3<float>(1, 2, 3));
+		EXPECT_EQ(static_cast<Point>(point3), point);
+		EXPECT_EQ(static_cast<Point>(point3).w(), 1);
+		EXPECT_FALSE((std::is_convertible<Point, Point3<double>>::value));
+	}
+
+	TEST(RML_Point3, transform_translates_points_only)
+	{
+		Transform transform;
+		transform.translate(1, 2, 3);
+		transform.rotate(0, 90, 0);
+		transform.scale(2, 3, 4);
+
+		const Point point(1, 2, 3);
+		const Vector vector(1, 2, 3);
+
+		EXPECT_EQ(static_cast<Point>(transform * Point3<double>(point)), transform * point);
+		EXPECT_EQ(static_cast<Vector>(transform * Vector3<double>(vector)), transform * vector);
+
+		const Affine3<float> affine(transform);
+
+		EXPECT_EQ(affine * Point3<float>(point), Point3<float>(Point(transform * point)));
+		EXPECT_EQ(affine * Vector3<float>(vector), Vector3<float>(Vector(transform * vector)));
+	}
+
+	TEST(RML_Point3, apply_to_arrays)
+	{
+		Transform transform;
+		transform.translate(1, 2, 3);
+		transform.rotate(30, 45, 60);
+
+		const Affine3<double> affine(transform);
+
+		std::vector<Point3<double>> points;
+		std::vector<Vector3<double>> vectors;
+
+		for (int i = 0; i < 25; ++i)
+		{
+			points.emplace_back(i, i * 0.5, -i);
+			vectors.emplace_back(-i, 1, i * 2.0);
+		}
+
+		std::vector<Point3<double>> transformedPoints(points.size());
+		std::vector<Vector3<double>> transformedVectors(vectors.size());
+		std::vector<Point3<double>> affinePoints(points.size());
+
+		transform.apply(points.data(), transformedPoints.data(), points.size());
+		transform.apply(vectors.data(), transformedVectors.data(), vectors.size());
+		affine.apply(points.data(), affinePoints.data(), points.size(), 0);
+
+		for (std::size_t i = 0; i < points.size(); ++i)
+		{
+			EXPECT_EQ(transformedPoints[i], transform * points[i]);
+			EXPECT_EQ(transformedVectors[i], transform * vectors[i]);
+			EXPECT_EQ(affinePoints[i], affine * points[i]);
+		}
+	}
+}
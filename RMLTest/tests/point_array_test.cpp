@@ -0,0 +1,289 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+#include "RML.h"
+
+namespace RML
+{
+	template<typename T>
+	VectorArray<T> test_vectors(const int count)
+	{
+		VectorArray<T> vectors;
+
+		for (int i = 0; i < count; ++i)
+		{
+			vectors.push_back(Vector3<T>(static_cast<T>(i + 1), static_cast<T>(i % 7) - 3, static_cast<T>(i) * static_cast<T>(0.5)));
+		}
+
+		return vectors;
+	}
+
+	template<typename T>
+	PointArray<T> test_points(const int count)
+	{
+		PointArray<T> points;
+
+		for (int i = 0; i < count; ++i)
+		{
+			points.push_back(Point3<T>(static_cast<T>(i % 11), static_cast<T>(-i), static_cast<T>(i % 5) * 2));
+		}
+
+		return points;
+	}
+
+	TEST(RML_PointArray, components_are_separate_aligned_arrays)
+	{
+		PointArray<float> points = test_points<float>(37);
+
+		EXPECT_EQ(points.size(), 37u);
+		EXPECT_EQ(reinterpret_cast<std::uintptr_t>(points.x()) % detail::HEAP_ALIGNMENT, 0u);
+		EXPECT_EQ(reinterpret_cast<std::uintptr_t>(points.y()) % detail::HEAP_ALIGNMENT, 0u);
+		EXPECT_EQ(reinterpret_cast<std::uintptr_t>(points.z()) % detail::HEAP_ALIGNMENT, 0u);
+
+		EXPECT_EQ(points.x()[12], 1);
+		EXPECT_EQ(points.y()[12], -12);
+		EXPECT_EQ(points.z()[12], 4);
+	}
+
+	TEST(RML_PointArray, items_read_and_write_as_points)
+	{
+		PointArray<double> points(3);
+
+		points[0] = Point3<double>(1, 2, 3);
+		points[1] = Point(4, 5, 6);
+		points[2] = points[0];
+
+		const Point point = points[1];
+		const Point3<double> point3 = points[2];
+
+		EXPECT_EQ(point, Point(4, 5, 6));
+		EXPECT_EQ(point3, Point3<double>(1, 2, 3));
+		EXPECT_EQ(points[0], Point3<double>(1, 2, 3));
+
+		const PointArray<double>& constPoints = points;
+
+		EXPECT_EQ(constPoints[1], Point3<double>(4, 5, 6));
+	}
+
+	TEST(RML_PointArray, construct_from_points)
+	{
+		const std::vector<Point> aos = { Point(1, 2, 3), Point(4, 5, 6) };
+		const PointArray<float> points(aos.data(), aos.size());
+
+		EXPECT_EQ(points, (PointArray<float>{ Point3<float>(1, 2, 3), Point3<float>(4, 5, 6) }));
+	}
+
+	TEST(RML_PointArray, iterators)
+	{
+		PointArray<float> points = test_points<float>(20);
+
+		std::vector<Point> copied;
+
+		for (const Point point : points)
+		{
+			copied.push_back(point);
+		}
+
+		ASSERT_EQ(copied.size(), 20u);
+		EXPECT_EQ(copied[7], Point(7, -7, 4));
+
+		for (auto point : points)
+		{
+			point = Point3<float>(point) + Vector3<float>(1, 0, 0);
+		}
+
+		EXPECT_EQ(points[7], Point3<float>(8, -7, 4));
+		EXPECT_EQ(points.end() - points.begin(), 20);
+
+		const PointArray<float>& constPoints = points;
+		const auto found = std::find_if(constPoints.begin(), constPoints.end(), [](const Point3<float> point) { return point.y() == -3; });
+
+		EXPECT_EQ(found - constPoints.cbegin(), 3);
+	}
+
+	TEST(RML_PointArray, difference_and_offsets)
+	{
+		const PointArray<double> a = test_points<double>(21);
+		const VectorArray<double> offsets = test_vectors<double>(21);
+
+		const PointArray<double> moved = a + offsets;
+		const VectorArray<double> difference = moved - a;
+
+		for (std::size_t i = 0; i < a.size(); ++i)
+		{
+			EXPECT_EQ(moved[i], a[i] + offsets[i]);
+			EXPECT_EQ(difference[i], offsets[i]);
+		}
+
+		PointArray<double> shifted = a;
+		shifted += Vector3<double>(1, 2, 3);
+		shifted -= Vector3<double>(0, 2, 0);
+
+		EXPECT_EQ(shifted[5], a[5] + Vector3<double>(1, 0, 3));
+	}
+
+	TEST(RML_PointArray, size_mismatch_leaves_points_unchanged)
+	{
+		PointArray<float> points = test_points<float>(4);
+		const PointArray<float> before = points;
+
+		points += test_vectors<float>(5);
+
+		EXPECT_EQ(points, before);
+		EXPECT_EQ((points - test_points<float>(3)).size(), 0u);
+	}
+
+	TEST(RML_PointArray, centroid_and_bounds)
+	{
+		const PointArray<float> points = test_points<float>(101);
+
+		Vector3<double> sum;
+		Point3<float> low = points[0];
+		Point3<float> high = points[0];
+
+		for (const Point3<float> point : points)
+		{
+			sum += Vector3<double>(point.x(), point.y(), point.z());
+			low = Point3<float>(Tuple3<float>::min(low, point));
+			high = Point3<float>(Tuple3<float>::max(high, point));
+		}
+
+		const Vector3<double> mean = sum / 101.0;
+
+		EXPECT_EQ(points.centroid(), Point3<float>(static_cast<float>(mean.x()), static_cast<float>(mean.y()), static_cast<float>(mean.z())));
+		EXPECT_EQ(points.min(), low);
+		EXPECT_EQ(points.max(), high);
+		EXPECT_EQ(points.min(), Point3<float>(0, -100, 0));
+		EXPECT_EQ(points.max(), Point3<float>(10, 0, 8));
+	}
+
+	TEST(RML_PointArray, apply_matches_single_points)
+	{
+		Transform transform;
+		transform.translate(1, 2, 3);
+		transform.rotate(10, 20, 30);
+		transform.scale(2, 3, 4);
+
+		const Quaternion rotation = Quaternion::euler_angles(30, 45, 60);
+
+		PointArray<double> points = test_points<double>(29);
+		const PointArray<double> original = points;
+
+		points.apply(transform);
+
+		for (std::size_t i = 0; i < points.size(); ++i)
+		{
+			EXPECT_EQ(points[i], transform * original[i]);
+		}
+
+		points = original;
+		points.apply(rotation);
+
+		for (std::size_t i = 0; i < points.size(); ++i)
+		{
+			EXPECT_EQ(static_cast<Point>(points[i]), Point(rotation.matrix() * static_cast<Point>(original[i])));
+		}
+	}
+
+	TEST(RML_PointArray, apply_float_threads)
+	{
+		const Affine3<float> affine(Transform().translate(1, 2, 3).rotate(0, 90, 0));
+
+		PointArray<float> points = test_points<float>(40000);
+		const PointArray<float> original = points;
+
+		points.apply(affine, 4);
+
+		for (std::size_t i = 0; i < points.size(); i += 997)
+		{
+			EXPECT_EQ(points[i], affine * original[i]);
+		}
+	}
+
+	TEST(RML_VectorArray, dot_and_cross)
+	{
+		const VectorArray<float> a = test_vectors<float>(19);
+		VectorArray<float> b = test_vectors<float>(19);
+		std::reverse(b.x(), b.x() + b.size());
+
+		std::vector<float> dots(a.size());
+		VectorArray<float>::dot(a, b, dots.data());
+
+		const VectorArray<float> crosses = VectorArray<float>::cross(a, b);
+
+		for (std::size_t i = 0; i < a.size(); ++i)
+		{
+			EXPECT_FLOAT_EQ(dots[i], Vector3<float>::dot(a[i], b[i]));
+			EXPECT_EQ(crosses[i], Vector3<float>::cross(a[i], b[i]));
+		}
+	}
+
+	TEST(RML_VectorArray, magnitude_and_normalize)
+	{
+		VectorArray<double> vectors = test_vectors<double>(23);
+		const VectorArray<double> original = vectors;
+
+		std::vector<double> magnitudes(vectors.size());
+		vectors.magnitude(magnitudes.data());
+
+		vectors.normalize();
+
+		for (std::size_t i = 0; i < vectors.size(); ++i)
+		{
+			EXPECT_DOUBLE_EQ(magnitudes[i], original[i].magnitude());
+			EXPECT_EQ(vectors[i], original[i].normalized());
+		}
+
+		EXPECT_EQ(original.normalized(), vectors);
+	}
+
+	TEST(RML_VectorArray, arithmetic)
+	{
+		const VectorArray<float> a = test_vectors<float>(13);
+		const VectorArray<float> b = a * 2.0f;
+
+		EXPECT_EQ((b - a), a);
+		EXPECT_EQ((a + a), b);
+
+		VectorArray<float> c = b;
+		c -= a;
+		c *= 3.0f;
+
+		EXPECT_EQ(c[12], a[12] * 3.0f);
+	}
+
+	TEST(RML_VectorArray, sum_min_max)
+	{
+		const VectorArray<double> vectors = test_vectors<double>(50);
+
+		Vector3<double> sum;
+
+		for (const Vector3<double> vector : vectors)
+		{
+			sum += vector;
+		}
+
+		EXPECT_EQ(vectors.sum(), sum);
+		EXPECT_EQ(vectors.min(), Vector3<double>(1, -3, 0));
+		EXPECT_EQ(vectors.max(), Vector3<double>(50, 3, 24.5));
+		EXPECT_EQ(VectorArray<double>().sum(), Vector3<double>());
+	}
+
+	TEST(RML_VectorArray, apply_does_not_translate)
+	{
+		Transform transform;
+		transform.translate(5, 6, 7);
+		transform.rotate(0, 0, 90);
+
+		VectorArray<float> vectors = test_vectors<float>(10);
+		const VectorArray<float> original = vectors;
+
+		vectors.apply(transform);
+
+		for (std::size_t i = 0; i < vectors.size(); ++i)
+		{
+			EXPECT_EQ(vectors[i], Vector3<float>(-original[i].y(), original[i].x(), original[i].z()));
+		}
+	}
+}
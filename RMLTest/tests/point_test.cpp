@@ -154,4 +154,16 @@ namespace RML
 
 		EXPECT_EQ(ss.str(), "4.3, -4.2, 3.1, 1");
 	}
+
+	TEST(RML_Point, constant_expression)
+	{
+		constexpr Point a(1, 2, 3);
+		constexpr Point b(3, 2, 1);
+		constexpr Vector difference = a - b;
+
+		static_assert(difference == Vector(-2, 0, 2));
+		static_assert(a - Vector(1, 1, 1) == Point(0, 1, 2));
+
+		EXPECT_EQ(difference, Vector(-2, 0, 2));
+	}
 }
@@ -28,6 +28,22 @@ namespace RML
 		EXPECT_EQ(result, expectedResult);
 	}
 
+	TEST(RML_Quaternion, construct_quaternion_from_matrix_largest_diagonal)
+	{
+		// Each rotation makes a different diagonal number the largest, so every branch of the conversion is taken
+		const Quaternion rotations[] = {
+			Quaternion::euler_angles(10, 20, 30),
+			Quaternion::euler_angles(0, 0, 160),
+			Quaternion::euler_angles(160, 0, 0),
+			Quaternion::euler_angles(0, 160, 0)
+		};
+
+		for (const Quaternion& rotation : rotations)
+		{
+			EXPECT_EQ(Quaternion(rotation.matrix()).matrix(), rotation.matrix());
+		}
+	}
+
 	TEST(RML_Quaternion, invert)
 	{
 		Quaternion q(1, 2, 3, 4);
@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+#include "RML.h"
+
+namespace RML
+{
+	// Runs the same products through the scalar kernels and the kernels Matrix uses,
+	// which are the SIMD kernels whenever RML_SSE2 / RML_AVX2 are enabled.
+	template<typename T>
+	class RML_Simd : public ::testing::Test {};
+
+	using SimdTypes = ::testing::Types<float, double>;
+	TYPED_TEST_SUITE(RML_Simd, SimdTypes);
+
+	static const double LHS[16] = {
+		1, 2, 3, 4,
+		5.5, 6.5, 7.5, 8.5,
+		9, -8, 7, -6,
+		-0.25, 4, 3, 2
+	};
+
+	static const double RHS[16] = {
+		-2, 1, 2, 3,
+		3, 2.5, 1, -1,
+		4, 3, -6, 5,
+		0.125, 2, 7, 8
+	};
+
+	TYPED_TEST(RML_Simd, multiply4x4_matches_scalar)
+	{
+		TypeParam a[16], b[16], scalar[16], result[16];
+
+		for (int i = 0; i < 16; ++i)
+		{
+			a[i] = static_cast<TypeParam>(LHS[i]);
+			b[i] = static_cast<TypeParam>(RHS[i]);
+		}
+
+		detail::multiply4x4_scalar(a, b, scalar);
+		detail::multiply4x4(a, b, result);
+
+		for (int i = 0; i < 16; ++i)
+		{
+			EXPECT_TRUE(equal(scalar[i], result[i])) << "Index " << i << ": " << scalar[i] << " != " << result[i];
+		}
+	}
+
+	TYPED_TEST(RML_Simd, multiply4x4_tuple_matches_scalar)
+	{
+		TypeParam m[16], v[4] = { 1, -2, 3.5, 1 }, scalar[4], result[4];
+
+		for (int i = 0; i < 16; ++i)
+		{
+			m[i] = static_cast<TypeParam>(LHS[i]);
+		}
+
+		detail::multiply4x4_tuple_scalar(m, v, scalar);
+		detail::multiply4x4_tuple(m, v, result);
+
+		for (int i = 0; i < 4; ++i)
+		{
+			EXPECT_TRUE(equal(scalar[i], result[i])) << "Index " << i << ": " << scalar[i] << " != " << result[i];
+		}
+	}
+
+	TYPED_TEST(RML_Simd, matrix_product_matches_scalar)
+	{
+		std::array<TypeParam, 16> a, b;
+
+		for (int i = 0; i < 16; ++i)
+		{
+			a[i] = static_cast<TypeParam>(LHS[i]);
+			b[i] = static_cast<TypeParam>(RHS[i]);
+		}
+
+		std::array<TypeParam, 16> scalar;
+		detail::multiply4x4_scalar(a.data(), b.data(), scalar.data());
+
+		EXPECT_EQ((Matrix<TypeParam, 4, 4>(a) * Matrix<TypeParam, 4, 4>(b)), (Matrix<TypeParam, 4, 4>(scalar)));
+	}
+
+	TYPED_TEST(RML_Simd, matrix_tuple_product_matches_scalar)
+	{
+		std::array<TypeParam, 16> m;
+
+		for (int i = 0; i < 16; ++i)
+		{
+			m[i] = static_cast<TypeParam>(LHS[i]);
+		}
+
+		TypeParam v[4] = { 1, -2, 3.5, 0 };
+		TypeParam scalar[4];
+		detail::multiply4x4_tuple_scalar(m.data(), v, scalar);
+
+		Tuple4<TypeParam> tuple(v[0], v[1], v[2], v[3]);
+		Tuple4<TypeParam> expectedResult(scalar[0], scalar[1], scalar[2], scalar[3]);
+
+		EXPECT_EQ((Matrix<TypeParam, 4, 4>(m) * tuple), expectedResult);
+	}
+}
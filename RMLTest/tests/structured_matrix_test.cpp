@@ -0,0 +1,178 @@
+#include <gtest/gtest.h>
+#include "RML.h"
+
+namespace RML
+{
+	static Matrix<double, 4, 4> dense_test_matrix()
+	{
+		return Matrix<double, 4, 4>({
+			1, 2, 3, 4,
+			5, 6, 7, 8,
+			9, 8, 7, 6,
+			5, 4, 3, 2
+			});
+	}
+
+	static RotationMatrix3<double> test_rotation()
+	{
+		return RotationMatrix3<double>(Quaternion::euler_angles(30, 45, 60));
+	}
+
+	TEST(RML_ScaleMatrix, matrix)
+	{
+		EXPECT_EQ(ScaleMatrix<double>(2, 3, 4).matrix(), (Matrix<double, 4, 4>({
+			2, 0, 0, 0,
+			0, 3, 0, 0,
+			0, 0, 4, 0,
+			0, 0, 0, 1
+			})));
+
+		EXPECT_EQ(ScaleMatrix<double>(5), ScaleMatrix<double>(5, 5, 5));
+		EXPECT_EQ(ScaleMatrix<double>().matrix(), (Matrix<double, 4, 4>::identity()));
+	}
+
+	TEST(RML_ScaleMatrix, multiplication_with_matrix)
+	{
+		const ScaleMatrix<double> scale(2, -3, 0.5);
+		const Matrix<double, 4, 4> matrix = dense_test_matrix();
+
+		EXPECT_EQ(scale * matrix, scale.matrix() * matrix);
+		EXPECT_EQ(matrix * scale, matrix * scale.matrix());
+		EXPECT_EQ((ColMajorMatrix<double, 4, 4>(matrix) * scale), matrix * scale.matrix());
+	}
+
+	TEST(RML_ScaleMatrix, multiplication_with_tuple)
+	{
+		const ScaleMatrix<double> scale(2, -3, 0.5);
+		const Tuple4<double> tuple(1, 2, 3, 1);
+
+		EXPECT_EQ(scale * tuple, scale.matrix() * tuple);
+	}
+
+	TEST(RML_ScaleMatrix, multiplication_with_scale)
+	{
+		EXPECT_EQ(ScaleMatrix<double>(2, 3, 4) * ScaleMatrix<double>(5, 6, 7), ScaleMatrix<double>(10, 18, 28));
+	}
+
+	TEST(RML_ScaleMatrix, inverse)
+	{
+		const ScaleMatrix<double> scale(2, -4, 0.5);
+
+		EXPECT_EQ(scale.inverse().matrix(), scale.matrix().invert());
+		EXPECT_EQ(scale * scale.inverse(), ScaleMatrix<double>());
+	}
+
+	TEST(RML_TranslationMatrix, matrix)
+	{
+		EXPECT_EQ(TranslationMatrix<double>(1, 2, 3).matrix(), (Matrix<double, 4, 4>({
+			1, 0, 0, 1,
+			0, 1, 0, 2,
+			0, 0, 1, 3,
+			0, 0, 0, 1
+			})));
+
+		EXPECT_EQ(TranslationMatrix<double>(Vector(1, 2, 3)), TranslationMatrix<double>(1, 2, 3));
+	}
+
+	TEST(RML_TranslationMatrix, multiplication_with_matrix)
+	{
+		const TranslationMatrix<double> translation(1, -2, 3);
+		const Matrix<double, 4, 4> matrix = dense_test_matrix();
+
+		EXPECT_EQ(translation * matrix, translation.matrix() * matrix);
+		EXPECT_EQ(matrix * translation, matrix * translation.matrix());
+		EXPECT_EQ((translation * ColMajorMatrix<double, 4, 4>(matrix)), translation.matrix() * matrix);
+	}
+
+	TEST(RML_TranslationMatrix, multiplication_with_tuple)
+	{
+		const TranslationMatrix<double> translation(1, -2, 3);
+
+		EXPECT_EQ(translation * Point(1, 2, 3), Tuple4<double>(2, 0, 6, 1));
+		EXPECT_EQ(translation * Vector(1, 2, 3), Tuple4<double>(1, 2, 3, 0));
+	}
+
+	TEST(RML_TranslationMatrix, inverse)
+	{
+		const TranslationMatrix<double> translation(1, -2, 3);
+
+		EXPECT_EQ(translation.inverse().matrix(), translation.matrix().invert());
+		EXPECT_EQ(translation * translation.inverse(), TranslationMatrix<double>());
+	}
+
+	TEST(RML_RotationMatrix3, matrix)
+	{
+		const Quaternion quaternion = Quaternion::euler_angles(30, 45, 60);
+
+		EXPECT_EQ(RotationMatrix3<double>(quaternion).matrix(), quaternion.matrix());
+		EXPECT_EQ(RotationMatrix3<double>().matrix(), (Matrix<double, 4, 4>::identity()));
+	}
+
+	TEST(RML_RotationMatrix3, multiplication_with_matrix)
+	{
+		const RotationMatrix3<double> rotation = test_rotation();
+		const Matrix<double, 4, 4> matrix = dense_test_matrix();
+
+		EXPECT_EQ(rotation * matrix, rotation.matrix() * matrix);
+		EXPECT_EQ(matrix * rotation, matrix * rotation.matrix());
+	}
+
+	TEST(RML_RotationMatrix3, multiplication_with_tuple)
+	{
+		const RotationMatrix3<double> rotation = test_rotation();
+		const Tuple4<double> tuple(1, 2, 3, 1);
+
+		EXPECT_EQ(rotation * tuple, rotation.matrix() * tuple);
+	}
+
+	TEST(RML_RotationMatrix3, inverse)
+	{
+		const RotationMatrix3<double> rotation = test_rotation();
+
+		EXPECT_EQ(rotation.inverse().matrix(), rotation.matrix().invert());
+		EXPECT_EQ(rotation * rotation.inverse(), RotationMatrix3<double>());
+	}
+
+	TEST(RML_StructuredMatrix, mixed_products)
+	{
+		const ScaleMatrix<double> s(2, -3, 0.5);
+		const TranslationMatrix<double> t(1, -2, 3);
+		const RotationMatrix3<double> r = test_rotation();
+
+		EXPECT_EQ((s * r).matrix(), s.matrix() * r.matrix());
+		EXPECT_EQ((r * s).matrix(), r.matrix() * s.matrix());
+		EXPECT_EQ((t * r).matrix(), t.matrix() * r.matrix());
+		EXPECT_EQ((r * t).matrix(), r.matrix() * t.matrix());
+		EXPECT_EQ((s * t).matrix(), s.matrix() * t.matrix());
+		EXPECT_EQ((t * s).matrix(), t.matrix() * s.matrix());
+		EXPECT_EQ((t * r * s).matrix(), t.matrix() * r.matrix() * s.matrix());
+	}
+
+	TEST(RML_StructuredMatrix, products_with_affine)
+	{
+		const Affine3<double> affine({
+			1, 2, 3, 4,
+			2, 4, 4, 2,
+			8, 6, 4, 1
+			});
+
+		const ScaleMatrix<double> s(2, -3, 0.5);
+		const TranslationMatrix<double> t(1, -2, 3);
+		const RotationMatrix3<double> r = test_rotation();
+
+		EXPECT_EQ((s * affine).matrix(), s.matrix() * affine.matrix());
+		EXPECT_EQ((affine * s).matrix(), affine.matrix() * s.matrix());
+		EXPECT_EQ((t * affine).matrix(), t.matrix() * affine.matrix());
+		EXPECT_EQ((affine * t).matrix(), affine.matrix() * t.matrix());
+		EXPECT_EQ((r * affine).matrix(), r.matrix() * affine.matrix());
+		EXPECT_EQ((affine * r).matrix(), affine.matrix() * r.matrix());
+	}
+
+	TEST(RML_StructuredMatrix, constant_expression)
+	{
+		constexpr Affine3<int> affine = TranslationMatrix<int>(1, 2, 3) * ScaleMatrix<int>(2, 3, 4);
+
+		static_assert(affine(0, 0) == 2 && affine(2, 3) == 3, "Structured products should be usable in a constant expression");
+		EXPECT_EQ(affine.matrix(), (TranslationMatrix<int>(1, 2, 3).matrix() * ScaleMatrix<int>(2, 3, 4).matrix()));
+	}
+}
@@ -1,5 +1,6 @@
 #include "gtest/gtest.h"
 #include <math.h>
+#include <vector>
 #include "RML.h"
 
 namespace RML
@@ -65,6 +66,123 @@ namespace RML
 		EXPECT_EQ(transform * vector, vector);
 	}
 
+	TEST(RML_Transform, transform_keeps_point_and_vector_types)
+	{
+		Transform transform = Transform()
+			.translate(5, -3, 2)
+			.rotate(0, 90, 0);
+
+		Point point = transform * Point(1, 2, 3);
+		Vector vector = transform * Vector(1, 2, 3);
+
+		EXPECT_EQ(point.w(), 1);
+		EXPECT_EQ(vector.w(), 0);
+		EXPECT_EQ(point, transform.matrix() * Point(1, 2, 3));
+		EXPECT_EQ(vector, transform.matrix() * Vector(1, 2, 3));
+	}
+
+	static Transform batch_transform()
+	{
+		return Transform()
+			.translate(10, 5, -5)
+			.rotate(120, 50, 90)
+			.scale(10, 5, 1.2);
+	}
+
+	TEST(RML_Transform, apply_points)
+	{
+		Transform transform = batch_transform();
+
+		std::vector<Point> points;
+		for (int i = 0; i < 11; ++i)
+		{
+			points.emplace_back(i, -2.0 * i, 0.5 * i + 1);
+		}
+
+		std::vector<Point> result(points.size());
+		transform.apply(points.data(), result.data(), points.size());
+
+		for (std::size_t i = 0; i < points.size(); ++i)
+		{
+			EXPECT_EQ(result[i], transform * points[i]);
+		}
+	}
+
+	TEST(RML_Transform, apply_vectors)
+	{
+		Transform transform = batch_transform();
+
+		std::vector<Vector> vectors;
+		for (int i = 0; i < 11; ++i)
+		{
+			vectors.emplace_back(i, -2.0 * i, 0.5 * i + 1);
+		}
+
+		std::vector<Vector> result = vectors;
+		transform.apply(result.data(), result.data(), result.size());
+
+		for (std::size_t i = 0; i < vectors.size(); ++i)
+		{
+			EXPECT_EQ(result[i], transform * vectors[i]);
+		}
+	}
+
+	TEST(RML_Transform, apply_separate_arrays)
+	{
+		Transform transform = batch_transform();
+
+		const std::size_t count = 13;
+		std::vector<double> x(count), y(count), z(count);
+
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			x[i] = i;
+			y[i] = -2.0 * i;
+			z[i] = 0.5 * i + 1;
+		}
+
+		std::vector<double> px(count), py(count), pz(count);
+		transform.apply(x.data(), y.data(), z.data(), px.data(), py.data(), pz.data(), count);
+
+		std::vector<double> vx(count), vy(count), vz(count);
+		transform.apply_vectors(x.data(), y.data(), z.data(), vx.data(), vy.data(), vz.data(), count);
+
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			EXPECT_EQ(Point(px[i], py[i], pz[i]), transform * Point(x[i], y[i], z[i]));
+			EXPECT_EQ(Vector(vx[i], vy[i], vz[i]), transform * Vector(x[i], y[i], z[i]));
+		}
+	}
+
+	TEST(RML_Transform, apply_on_several_threads)
+	{
+		Transform transform = batch_transform();
+
+		const std::size_t count = 100003;
+		std::vector<double> x(count), y(count), z(count);
+		std::vector<Point> points(count);
+
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			x[i] = i * 0.001;
+			y[i] = 1.0 - i * 0.002;
+			z[i] = 3.0;
+			points[i] = Point(x[i], y[i], z[i]);
+		}
+
+		std::vector<Point> result(count);
+		transform.apply(points.data(), result.data(), count, 4);
+		transform.apply(x.data(), y.data(), z.data(), x.data(), y.data(), z.data(), count, 4);
+
+		for (std::size_t i = 0; i < count; i += 997)
+		{
+			Point expectedResult = transform * points[i];
+
+			EXPECT_EQ(result[i], expectedResult);
+			EXPECT_EQ(Point(x[i], y[i], z[i]), expectedResult);
+		}
+	}
+
 	TEST(RML_Transform, scale_point)
 	{
 		Transform transform = Transform()
@@ -263,7 +381,7 @@ namespace RML
 
 		Quaternion expectedRotation = Quaternion::euler_angles(0, 90, 0);
 
-		EXPECT_EQ(t.rotation, expectedRotation);
+		EXPECT_EQ(t.rotation(), expectedRotation);
 	}
 
 	TEST(RML_Transform, individual_transformations_are_applied_in_sequence)
@@ -382,4 +500,99 @@ namespace RML
 
 		EXPECT_TRUE(a != b);
 	}
+
+	TEST(RML_Transform, matrix_is_rebuilt_after_mutation)
+	{
+		Transform t;
+
+		const Matrix<double, 4, 4>& matrix = t.matrix();
+		EXPECT_EQ(matrix, (Matrix<double, 4, 4>::identity()));
+
+		t.translate(1, 2, 3);
+		EXPECT_EQ(t.matrix(), Transform().translate(1, 2, 3).matrix());
+		EXPECT_EQ(&t.matrix(), &matrix);
+
+		t.scale(2, 2, 2);
+		EXPECT_EQ(t.matrix(), Transform().translate(1, 2, 3).scale(2, 2, 2).matrix());
+
+		t.rotate(0, 90, 0);
+		EXPECT_EQ(t.matrix(), Transform().translate(1, 2, 3).scale(2, 2, 2).rotate(0, 90, 0).matrix());
+	}
+
+	TEST(RML_Transform, inverse_is_rebuilt_after_mutation)
+	{
+		Transform t = Transform().translate(1, 2, 3);
+
+		EXPECT_EQ(t.get_inverted(), Transform().translate(-1, -2, -3).matrix());
+
+		t.set_position(Vector(4, 5, 6));
+		EXPECT_EQ(t.get_inverted(), Transform().translate(-4, -5, -6).matrix());
+
+		t.set_scaling(Vector(2, 2, 2));
+		EXPECT_EQ(t.get_inverted(), t.matrix().invert());
+	}
+
+	TEST(RML_Transform, setters_replace_components)
+	{
+		Transform t;
+
+		t.set_position(Vector(1, 2, 3));
+		t.set_rotation(Quaternion::euler_angles(0, 90, 0));
+		t.set_scaling(Vector(4, 5, 6));
+
+		EXPECT_EQ(t.position(), Vector(1, 2, 3));
+		EXPECT_EQ(t.rotation(), Quaternion::euler_angles(0, 90, 0));
+		EXPECT_EQ(t.scaling(), Vector(4, 5, 6));
+		EXPECT_EQ(t.matrix(), Transform().translate(1, 2, 3).rotate(0, 90, 0).scale(4, 5, 6).matrix());
+	}
+
+	TEST(RML_Transform, matrix_matches_composed_trs)
+	{
+		Transform t = Transform()
+			.translate(1, -2, 3)
+			.rotate(30, 45, 60)
+			.scale(2, 3, 4);
+
+		Matrix<double, 4, 4> tMatrix({
+			1, 0, 0, 1,
+			0, 1, 0, -2,
+			0, 0, 1, 3,
+			0, 0, 0, 1
+		});
+
+		Matrix<double, 4, 4> sMatrix({
+			2, 0, 0, 0,
+			0, 3, 0, 0,
+			0, 0, 4, 0,
+			0, 0, 0, 1
+		});
+
+		EXPECT_EQ(t.matrix(), tMatrix * t.rotation().matrix() * sMatrix);
+	}
+
+	TEST(RML_Transform, inverse_matches_general_inverse)
+	{
+		Transform t = Transform()
+			.translate(1, -2, 3)
+			.rotate(30, 45, 60)
+			.scale(2, 3, 4);
+
+		EXPECT_EQ(t.get_inverted(), t.matrix().invert());
+		EXPECT_EQ(t.get_inverted() * t.matrix(), (Matrix<double, 4, 4>::identity()));
+	}
+
+	TEST(RML_Transform, inverse_of_rigid_and_uniform_transforms)
+	{
+		Transform rigid = Transform()
+			.translate(1, -2, 3)
+			.rotate(30, 45, 60);
+
+		Transform uniform = Transform()
+			.translate(1, -2, 3)
+			.rotate(30, 45, 60)
+			.scale(3, 3, 3);
+
+		EXPECT_EQ(rigid.get_inverted(), rigid.matrix().invert());
+		EXPECT_EQ(uniform.get_inverted(), uniform.matrix().invert());
+	}
 }
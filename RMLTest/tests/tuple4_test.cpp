@@ -1,4 +1,5 @@
 #include <gtest/gtest.h>
+#include <limits>
 #include "RML.h"
 
 namespace RML
@@ -243,4 +244,75 @@ namespace RML
 
 		EXPECT_EQ(ss.str(), "4.3, -4.2, 3.1, 1");
 	}
+
+	TEST(RML_Tuple4, constant_expression)
+	{
+		constexpr Tuple4<double> a(1, 2, 3, 4);
+		constexpr Tuple4<double> b(4, 3, 2, 1);
+		constexpr Tuple4<double> sum = a + b;
+
+		static_assert(sum == Tuple4<double>(5, 5, 5, 5));
+		static_assert((a * 2.0).w() == 8);
+		static_assert(-a == Tuple4<double>(-1, -2, -3, -4));
+
+		EXPECT_EQ(sum, Tuple4<double>(5, 5, 5, 5));
+	}
+
+	TEST(RML_Tuple4, is_aligned_to_its_size)
+	{
+		EXPECT_EQ(alignof(Tuple4<float>), 16u);
+		EXPECT_EQ(alignof(Tuple4<double>), 32u);
+		EXPECT_EQ(sizeof(Tuple4<double>), sizeof(double) * 4);
+		EXPECT_EQ(alignof(Point), 32u);
+	}
+
+	TEST(RML_Tuple4, arithmetic_float)
+	{
+		const Tuple4<float> a(1.5f, -2, 3, 1);
+		const Tuple4<float> b(0.5f, 4, -1, 0);
+
+		EXPECT_EQ(a + b, Tuple4<float>(2, 2, 2, 1));
+		EXPECT_EQ(a - b, Tuple4<float>(1, -6, 4, 1));
+		EXPECT_EQ(a * b, Tuple4<float>(0.75f, -8, -3, 0));
+		EXPECT_EQ(a * 2.0f, Tuple4<float>(3, -4, 6, 2));
+		EXPECT_EQ(a / 2.0f, Tuple4<float>(0.75f, -1, 1.5f, 0.5f));
+		EXPECT_EQ(-a, Tuple4<float>(-1.5f, 2, -3, -1));
+	}
+
+	TEST(RML_Tuple4, equality_within_epsilon)
+	{
+		const Tuple4<double> a(1, 2, 3, 4);
+
+		EXPECT_TRUE(a == Tuple4<double>(1 + EPSILON / 2, 2, 3, 4));
+		EXPECT_FALSE(a == Tuple4<double>(1, 2, 3, 4 + EPSILON * 2));
+		EXPECT_TRUE(Tuple4<float>(1, 2, 3, 4) == Tuple4<float>(1, 2, 3 - EPSILON / 2, 4));
+		EXPECT_FALSE(Tuple4<float>(1, 2, 3, 4) == Tuple4<float>(1, 2 + EPSILON * 2, 3, 4));
+	}
+
+	TEST(RML_Tuple4, equality_infinity)
+	{
+		EXPECT_TRUE(Tuple4<double>(INF, 0, -INF, 1) == Tuple4<double>(INF, 0, -INF, 1));
+		EXPECT_FALSE(Tuple4<double>(INF, 0, 0, 1) == Tuple4<double>(-INF, 0, 0, 1));
+		EXPECT_FALSE(Tuple4<double>(INF, 0, 0, 1) == Tuple4<double>(1e300, 0, 0, 1));
+
+		const float inf = std::numeric_limits<float>::infinity();
+
+		EXPECT_TRUE(Tuple4<float>(0, inf, 0, 1) == Tuple4<float>(0, inf, 0, 1));
+		EXPECT_FALSE(Tuple4<float>(0, inf, 0, 1) == Tuple4<float>(0, -inf, 0, 1));
+	}
+
+	TEST(RML_Tuple4, min_and_max)
+	{
+		const Tuple4<double> a(1, -2, 3, 0);
+		const Tuple4<double> b(-1, 2, 3, 1);
+
+		EXPECT_EQ(Tuple4<double>::min(a, b), Tuple4<double>(-1, -2, 3, 0));
+		EXPECT_EQ(Tuple4<double>::max(a, b), Tuple4<double>(1, 2, 3, 1));
+		EXPECT_EQ(Tuple4<float>::min(Tuple4<float>(1, 5, -3, 0), Tuple4<float>(2, 4, -4, 0)), Tuple4<float>(1, 4, -4, 0));
+		EXPECT_EQ(Tuple4<int>::max(Tuple4<int>(1, 5, -3, 0), Tuple4<int>(2, 4, -4, 0)), Tuple4<int>(2, 5, -3, 0));
+
+		constexpr Tuple4<double> clamped = Tuple4<double>::min(Tuple4<double>::max(Tuple4<double>(-4, 5, 0.5, 1), Tuple4<double>(-1, -1, -1, -1)), Tuple4<double>(1, 1, 1, 1));
+
+		static_assert(clamped.x() == -1 && clamped.y() == 1 && clamped.z() == 0.5);
+	}
 }
@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include "RML.h"
+
+namespace RML
+{
+	TEST(RML_Vec, tuples_are_vecs)
+	{
+		EXPECT_TRUE((std::is_same<Tuple2<double>, Vec<double, 2>>::value));
+		EXPECT_TRUE((std::is_same<Tuple3<float>, Vec<float, 3>>::value));
+		EXPECT_TRUE((std::is_same<Tuple4<int>, Vec<int, 4>>::value));
+	}
+
+	TEST(RML_Vec, size_and_alignment)
+	{
+		EXPECT_EQ(sizeof(Vec<float, 2>), 8u);
+		EXPECT_EQ(alignof(Vec<float, 2>), 8u);
+		EXPECT_EQ(sizeof(Vec<double, 2>), 16u);
+		EXPECT_EQ(alignof(Vec<double, 2>), 16u);
+
+		// A Vec of 3 numbers is not padded
+		EXPECT_EQ(sizeof(Vec<float, 3>), sizeof(float) * 3);
+		EXPECT_EQ(sizeof(Vec<double, 3>), sizeof(double) * 3);
+	}
+
+	TEST(RML_Vec, index_and_data)
+	{
+		Vec<double, 3> vec(1, 2, 3);
+
+		EXPECT_EQ(vec[0], 1);
+		EXPECT_EQ(vec[2], 3);
+
+		vec[1] = 5;
+
+		EXPECT_EQ(vec.y(), 5);
+		EXPECT_EQ(vec.data()[1], 5);
+	}
+
+	TEST(RML_Vec, arithmetic_two_components)
+	{
+		const Vec<float, 2> a(1.5f, -2);
+		const Vec<float, 2> b(0.5f, 4);
+
+		EXPECT_EQ(a + b, (Vec<float, 2>(2, 2)));
+		EXPECT_EQ(a - b, (Vec<float, 2>(1, -6)));
+		EXPECT_EQ(a * b, (Vec<float, 2>(0.75f, -8)));
+		EXPECT_EQ(a / 2.0f, (Vec<float, 2>(0.75f, -1)));
+		EXPECT_EQ(-a, (Vec<float, 2>(-1.5f, 2)));
+
+		const Vec<double, 2> c(1.5, -2);
+		const Vec<double, 2> d(0.5, 4);
+
+		EXPECT_EQ(c + d, (Vec<double, 2>(2, 2)));
+		EXPECT_EQ(c * 2.0, (Vec<double, 2>(3, -4)));
+		EXPECT_EQ((Vec<double, 2>::max(c, d)), (Vec<double, 2>(1.5, 4)));
+	}
+
+	TEST(RML_Vec, arithmetic_three_components)
+	{
+		const Vec<float, 3> a(1.5f, -2, 3);
+		const Vec<float, 3> b(0.5f, 4, -1);
+
+		EXPECT_EQ(a + b, (Vec<float, 3>(2, 2, 2)));
+		EXPECT_EQ(a - b, (Vec<float, 3>(1, -6, 4)));
+		EXPECT_EQ(a * 2.0f, (Vec<float, 3>(3, -4, 6)));
+		EXPECT_EQ((Vec<float, 3>::min(a, b)), (Vec<float, 3>(0.5f, -2, -1)));
+
+		const Vec<double, 3> c(1.5, -2, 3);
+		const Vec<double, 3> d(0.5, 4, -1);
+
+		EXPECT_EQ(c + d, (Vec<double, 3>(2, 2, 2)));
+		EXPECT_EQ(c * d, (Vec<double, 3>(0.75, -8, -3)));
+		EXPECT_EQ(c / 2.0, (Vec<double, 3>(0.75, -1, 1.5)));
+		EXPECT_EQ(-c, (Vec<double, 3>(-1.5, 2, -3)));
+	}
+
+	TEST(RML_Vec, arithmetic_does_not_write_past_the_components)
+	{
+		struct Packed
+		{
+			Vec<double, 3> vec;
+			double after;
+		};
+
+		Packed packed{ Vec<double, 3>(1, 2, 3), 42 };
+
+		packed.vec += Vec<double, 3>(1, 1, 1);
+		packed.vec *= 2.0;
+
+		EXPECT_EQ(packed.vec, (Vec<double, 3>(4, 6, 8)));
+		EXPECT_EQ(packed.after, 42);
+	}
+
+	TEST(RML_Vec, equality_compares_only_the_components)
+	{
+		EXPECT_TRUE((Vec<double, 3>(1, 2, 3) == Vec<double, 3>(1, 2, 3 + EPSILON / 2)));
+		EXPECT_FALSE((Vec<double, 3>(1, 2, 3) == Vec<double, 3>(1, 2, 3 + EPSILON * 2)));
+		EXPECT_FALSE((Vec<float, 3>(1, 2, 3) == Vec<float, 3>(1, 2, 4)));
+		EXPECT_FALSE((Vec<float, 2>(1, 2) == Vec<float, 2>(1, 3)));
+		EXPECT_TRUE((Vec<double, 2>(INF, 2) == Vec<double, 2>(INF, 2)));
+	}
+
+	TEST(RML_Vec, multiplication_compound)
+	{
+		Tuple4<double> tuple(1, 2, 3, 4);
+		tuple *= Tuple4<double>(2, 0.5, -1, 0);
+
+		EXPECT_EQ(tuple, Tuple4<double>(2, 1, -3, 0));
+
+		Tuple3<int> integers(1, 2, 3);
+		integers *= Tuple3<int>(3, 2, 1);
+
+		EXPECT_EQ(integers, Tuple3<int>(3, 4, 3));
+	}
+
+	TEST(RML_Vec, ostream)
+	{
+		std::stringstream ss;
+		ss << Vec<int, 3>(1, -2, 3);
+
+		EXPECT_EQ(ss.str(), "1, -2, 3");
+	}
+
+	TEST(RML_Vec, constant_expression)
+	{
+		constexpr Vec<double, 3> a(1, 2, 3);
+		constexpr Vec<double, 3> product = a * Vec<double, 3>(2, 2, 2) - Vec<double, 3>(1, 1, 1);
+
+		static_assert(product == Vec<double, 3>(1, 3, 5));
+		static_assert(Vec<int, 2>::min(Vec<int, 2>(1, 5), Vec<int, 2>(3, 2)) == Vec<int, 2>(1, 2));
+		static_assert((a / 2.0)[2] == 1.5);
+
+		EXPECT_EQ(product, (Vec<double, 3>(1, 3, 5)));
+	}
+}
@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+#include "RML.h"
+
+namespace RML
+{
+	TEST(RML_Vector3, is_smaller_than_vector)
+	{
+		EXPECT_EQ(sizeof(Vector3<float>), sizeof(float) * 3);
+		EXPECT_EQ(sizeof(Vector3<double>), sizeof(double) * 3);
+		EXPECT_LT(sizeof(Vector3<double>), sizeof(Vector));
+	}
+
+	TEST(RML_Vector3, arithmetic)
+	{
+		const Vector3<double> a(1, 2, 3);
+		const Vector3<double> b(-4, 5, 0.5);
+
+		EXPECT_EQ(a + b, Vector3<double>(-3, 7, 3.5));
+		EXPECT_EQ(a - b, Vector3<double>(5, -3, 2.5));
+		EXPECT_EQ(-a, Vector3<double>(-1, -2, -3));
+		EXPECT_EQ(a * 2.0, Vector3<double>(2, 4, 6));
+		EXPECT_EQ(a / 2.0, Vector3<double>(0.5, 1, 1.5));
+
+		Vector3<double> c = a;
+		c += b;
+		c *= 2.0;
+
+		EXPECT_EQ(c, Vector3<double>(-6, 14, 7));
+	}
+
+	TEST(RML_Vector3, dot_cross_and_magnitude)
+	{
+		const Vector3<float> a(1, 2, 3);
+		const Vector3<float> b(2, 3, 4);
+
+		EXPECT_EQ(Vector3<float>::dot(a, b), 20);
+		EXPECT_EQ(Vector3<float>::cross(a, b), Vector3<float>(-1, 2, -1));
+		EXPECT_EQ(Vector3<float>(0, 3, 4).magnitude(), 5);
+		EXPECT_EQ(Vector3<float>(0, 3, 4).normalized(), Vector3<float>(0, 0.6f, 0.8f));
+	}
+
+	TEST(RML_Vector3, matches_vector)
+	{
+		const Vector a(1, 2, 3);
+		const Vector b(-4, 5, 0.5);
+
+		const Vector3<double> a3(a);
+		const Vector3<double> b3(b);
+
+		EXPECT_EQ(static_cast<Vector>(Vector3<double>::cross(a3, b3)), Vector::cross(a, b));
+		EXPECT_EQ(Vector3<double>::dot(a3, b3), Vector::dot(a, b));
+		EXPECT_EQ(static_cast<Vector>(a3 + b3), Vector(a + b));
+		EXPECT_EQ(static_cast<Vector>(a3).w(), 0);
+	}
+
+	TEST(RML_Vector3, constant_expression)
+	{
+		constexpr Vector3<double> cross = Vector3<double>::cross(Vector3<double>(1, 0, 0), Vector3<double>(0, 1, 0));
+
+		static_assert(cross.z() == 1);
+		static_assert(Vector3<int>::dot(Vector3<int>(1, 2, 3), Vector3<int>(4, 5, 6)) == 32);
+
+		EXPECT_EQ(cross, Vector3<double>(0, 0, 1));
+	}
+}
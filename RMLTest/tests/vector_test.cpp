@@ -366,4 +366,15 @@ namespace RML
 
 		EXPECT_EQ(ss.str(), "4.3, -4.2, 3.1, 0");
 	}
+
+	TEST(RML_Vector, constant_expression)
+	{
+		constexpr Vector cross = Vector::cross(Vector::right(), Vector::up());
+
+		static_assert(cross == Vector::forward());
+		static_assert(Vector::dot(Vector::up(), Vector::down()) == -1);
+		static_assert(Vector::one() - Vector::zero() == Vector(1, 1, 1));
+
+		EXPECT_EQ(cross, Vector::forward());
+	}
 }
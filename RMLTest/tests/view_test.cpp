@@ -0,0 +1,240 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include "RML.h"
+
+namespace RML
+{
+	TEST(RML_MatrixView, row_major)
+	{
+		float buffer[6] = {
+			1, 2, 3,
+			4, 5, 6
+		};
+
+		MatrixView<float, 2, 3> view(buffer);
+
+		EXPECT_EQ(view(0, 2), 3);
+		EXPECT_EQ(view(1, 0), 4);
+
+		view(1, 1) = 10;
+
+		EXPECT_EQ(buffer[4], 10);
+	}
+
+	TEST(RML_MatrixView, column_major)
+	{
+		const double buffer[6] = {
+			1, 4,
+			2, 5,
+			3, 6
+		};
+
+		MatrixView<const double, 2, 3, Layout::ColumnMajor> view(buffer);
+
+		EXPECT_EQ(view.matrix(), (Matrix<double, 2, 3>({
+			1, 2, 3,
+			4, 5, 6
+			})));
+	}
+
+	TEST(RML_MatrixView, stride)
+	{
+		// Two padding numbers after every row
+		const int buffer[10] = {
+			1, 2, 3, -1, -1,
+			4, 5, 6, -1, -1
+		};
+
+		MatrixView<const int, 2, 3> view(buffer, 5);
+
+		EXPECT_EQ(view, (Matrix<int, 2, 3>({
+			1, 2, 3,
+			4, 5, 6
+			})));
+	}
+
+	TEST(RML_MatrixView, transpose_does_not_copy)
+	{
+		double buffer[6] = {
+			1, 2, 3,
+			4, 5, 6
+		};
+
+		MatrixView<double, 2, 3> view(buffer);
+		auto transposed = view.transpose();
+
+		EXPECT_EQ(transposed.data(), buffer);
+		EXPECT_EQ(transposed, (Matrix<double, 2, 3>({
+			1, 2, 3,
+			4, 5, 6
+			}).transpose()));
+	}
+
+	TEST(RML_MatrixView, view_of_matrix)
+	{
+		Matrix<double, 2, 2> matrix({
+			1, 2,
+			3, 4
+			});
+
+		view(matrix)(0, 1) = 7;
+
+		EXPECT_EQ(matrix(0, 1), 7);
+		EXPECT_EQ(view(static_cast<const Matrix<double, 2, 2>&>(matrix)).data(), matrix.data());
+	}
+
+	TEST(RML_MatrixView, multiplication)
+	{
+		const Matrix<double, 4, 4> a({
+			1, 2, 3, 4,
+			5, 6, 7, 8,
+			9, 8, 7, 6,
+			5, 4, 3, 2
+			});
+
+		const Matrix<double, 4, 4> b({
+			-2, 1, 2, 3,
+			3, 2, 1, -1,
+			4, 3, 6, 5,
+			1, 2, 7, 8
+			});
+
+		const Matrix<double, 4, 4> bt = b.transpose();
+		MatrixView<const double, 4, 4, Layout::ColumnMajor> bView(bt.data());
+
+		EXPECT_EQ(view(a) * bView, a * b);
+		EXPECT_EQ(a * bView, a * b);
+		EXPECT_EQ(view(a) * b, a * b);
+	}
+
+	TEST(RML_MatrixView, multiplication_with_tuple)
+	{
+		const Matrix<double, 4, 4> a({
+			1, 2, 3, 4,
+			2, 4, 4, 2,
+			8, 6, 4, 1,
+			0, 0, 0, 1
+			});
+
+		const Tuple4<double> tuple(1, 2, 3, 1);
+
+		EXPECT_EQ(view(a) * tuple, a * tuple);
+	}
+
+	TEST(RML_MatrixView, sum_and_difference)
+	{
+		double buffer[4] = { 1, 2, 3, 4 };
+		MatrixView<double, 2, 2> view(buffer);
+
+		const Matrix<double, 2, 2> other({
+			4, 3,
+			2, 1
+			});
+
+		EXPECT_EQ(view + other, (Matrix<double, 2, 2>({ 5, 5, 5, 5 })));
+		EXPECT_EQ(view - other, (Matrix<double, 2, 2>({ -3, -1, 1, 3 })));
+	}
+
+	TEST(RML_MatrixView, assign)
+	{
+		float buffer[4] = {};
+		MatrixView<float, 2, 2, Layout::ColumnMajor> view(buffer);
+
+		view.assign(Matrix<float, 2, 2>({
+			1, 2,
+			3, 4
+			}));
+
+		EXPECT_EQ(buffer[0], 1);
+		EXPECT_EQ(buffer[1], 3);
+		EXPECT_EQ(buffer[2], 2);
+		EXPECT_EQ(buffer[3], 4);
+	}
+
+	TEST(RML_Tuple4Span, read_and_write)
+	{
+		// x, y, z, w and a texture coordinate per element
+		float buffer[12] = {
+			1, 2, 3, 1, 0.5f, 0.5f,
+			4, 5, 6, 0, 0.25f, 0.75f
+		};
+
+		Tuple4Span<float> span(buffer, 2, 6);
+
+		EXPECT_EQ(span.size(), 2u);
+		EXPECT_EQ(span[1], Tuple4<float>(4, 5, 6, 0));
+
+		span.set(0, Tuple4<float>(7, 8, 9, 1));
+
+		EXPECT_EQ(buffer[0], 7);
+		EXPECT_EQ(buffer[4], 0.5f);
+		EXPECT_EQ(span.subspan(1, 1)[0], span[1]);
+	}
+
+	TEST(RML_Tuple4Span, apply)
+	{
+		const Matrix<double, 4, 4> matrix({
+			1, 2, 3, 4,
+			2, 4, 4, 2,
+			8, 6, 4, 1,
+			0, 0, 0, 1
+			});
+
+		std::vector<double> buffer = {
+			1, 2, 3, 1,
+			-1, 0, 2, 0,
+			4, 4, 4, 1
+		};
+
+		const std::vector<double> original = buffer;
+		Tuple4Span<double> span(buffer.data(), 3);
+
+		apply(matrix, span, span);
+
+		for (std::size_t i = 0; i < 3; ++i)
+		{
+			EXPECT_EQ(span[i], matrix * Tuple4Span<const double>(original.data(), 3)[i]);
+		}
+	}
+
+	TEST(RML_PointSpan, apply_interleaved)
+	{
+		// Position, normal and a padding number per vertex
+		std::vector<double> vertices(7 * 100);
+
+		for (std::size_t i = 0; i < 100; ++i)
+		{
+			vertices[i * 7 + 0] = static_cast<double>(i);
+			vertices[i * 7 + 1] = static_cast<double>(i) * 0.5;
+			vertices[i * 7 + 2] = -static_cast<double>(i);
+			vertices[i * 7 + 3] = 0;
+			vertices[i * 7 + 4] = 1;
+			vertices[i * 7 + 5] = 0;
+			vertices[i * 7 + 6] = 42;
+		}
+
+		const Matrix<double, 4, 4> matrix({
+			0, -1, 0, 5,
+			1, 0, 0, -2,
+			0, 0, 2, 1,
+			0, 0, 0, 1
+			});
+
+		std::vector<double> out(3 * 100);
+
+		PointSpan<const double> in(vertices.data(), 100, 7);
+		apply(matrix, in, PointSpan<double>(out.data(), 100), 0);
+
+		for (std::size_t i = 0; i < 100; ++i)
+		{
+			EXPECT_EQ(Point(PointSpan<double>(out.data(), 100)[i]), matrix.transform_point(Point(in[i])));
+		}
+
+		// The normals and padding are left alone when transforming in place
+		apply(matrix, PointSpan<double>(vertices.data(), 100, 7), PointSpan<double>(vertices.data(), 100, 7));
+
+		EXPECT_EQ(vertices[7 * 3 + 4], 1);
+		EXPECT_EQ(vertices[7 * 3 + 6], 42);
+		EXPECT_EQ(PointSpan<double>(vertices.data(), 100, 7)[3], PointSpan<double>(out.data(), 100)[3]);
+	}
+}